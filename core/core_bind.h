@@ -67,11 +67,24 @@ public:
 		CACHE_MODE_REPLACE_DEEP,
 	};
 
+	enum LoadPriority {
+		LOAD_PRIORITY_NORMAL,
+		LOAD_PRIORITY_HIGH,
+	};
+
+protected:
+#ifndef DISABLE_DEPRECATED
+	Error _load_threaded_request_bind_compat_load_priority(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, CacheMode p_cache_mode);
+	static void _bind_compatibility_methods();
+#endif // DISABLE_DEPRECATED
+
+public:
 	static ResourceLoader *get_singleton() { return singleton; }
 
-	Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE);
+	Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE, LoadPriority p_priority = LOAD_PRIORITY_NORMAL);
 	ThreadLoadStatus load_threaded_get_status(const String &p_path, Array r_progress = ClassDB::default_array_arg);
 	Ref<Resource> load_threaded_get(const String &p_path);
+	Error load_threaded_cancel(const String &p_path);
 
 	Ref<Resource> load(const String &p_path, const String &p_type_hint = "", CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	Vector<String> get_recognized_extensions_for_type(const String &p_type);
@@ -656,6 +669,7 @@ public:
 
 VARIANT_ENUM_CAST(core_bind::ResourceLoader::ThreadLoadStatus);
 VARIANT_ENUM_CAST(core_bind::ResourceLoader::CacheMode);
+VARIANT_ENUM_CAST(core_bind::ResourceLoader::LoadPriority);
 
 VARIANT_BITFIELD_CAST(core_bind::ResourceSaver::SaverFlags);
 
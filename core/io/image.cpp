@@ -3365,6 +3365,10 @@ int64_t Image::get_data_size() const {
 	return data.size();
 }
 
+uint64_t Image::get_memory_usage() const {
+	return data.size();
+}
+
 void Image::adjust_bcs(float p_brightness, float p_contrast, float p_saturation) {
 	ERR_FAIL_COND_MSG(!_can_modify(format), "Cannot adjust_bcs in compressed or custom image formats.");
 
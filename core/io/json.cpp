@@ -33,6 +33,7 @@
 #include "core/config/engine.h"
 #include "core/object/script_language.h"
 #include "core/variant/container_type_validate.h"
+#include "core/variant/variant_internal.h"
 
 const char *JSON::tk_name[TK_MAX] = {
 	"'{'",
@@ -47,42 +48,52 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-String JSON::_make_indent(const String &p_indent, int p_size) {
-	return p_indent.repeat(p_size);
+void JSON::_append_indent(StringBuilder &r_builder, const String &p_indent, int p_size) {
+	for (int i = 0; i < p_size; i++) {
+		r_builder.append(p_indent);
+	}
 }
 
-String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
-	ERR_FAIL_COND_V_MSG(p_cur_indent > Variant::MAX_RECURSION_DEPTH, "...", "JSON structure is too deep. Bailing.");
+void JSON::_stringify(StringBuilder &r_builder, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
+		r_builder.append("...");
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
+	}
 
-	String colon = ":";
-	String end_statement = "";
+	const char *colon = ":";
+	const char *end_statement = "";
 
 	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+		colon = ": ";
+		end_statement = "\n";
 	}
 
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			r_builder.append("null");
+			return;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			r_builder.append(p_var.operator bool() ? "true" : "false");
+			return;
 		case Variant::INT:
-			return itos(p_var);
+			r_builder.append(itos(p_var));
+			return;
 		case Variant::FLOAT: {
 			double num = p_var;
 
 			// Only for exactly 0. If we have approximately 0 let the user decide how much
 			// precision they want.
 			if (num == double(0)) {
-				return String("0.0");
+				r_builder.append("0.0");
+				return;
 			}
 
 			double magnitude = log10(Math::abs(num));
 			int total_digits = p_full_precision ? 17 : 14;
 			int precision = MAX(1, total_digits - (int)Math::floor(magnitude));
 
-			return String::num(num, precision);
+			r_builder.append(String::num(num, precision));
+			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
@@ -92,36 +103,48 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (a.is_empty()) {
-				return "[]";
+				r_builder.append("[]");
+				return;
 			}
-			String s = "[";
-			s += end_statement;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), "\"[...]\"", "Converting circular structure to JSON.");
+			if (p_markers.has(a.id())) {
+				r_builder.append("\"[...]\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(a.id());
 
+			r_builder.append("[");
+			r_builder.append(end_statement);
+
 			bool first = true;
 			for (const Variant &var : a) {
 				if (first) {
 					first = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_builder.append(",");
+					r_builder.append(end_statement);
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_append_indent(r_builder, p_indent, p_cur_indent + 1);
+				_stringify(r_builder, var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
+			r_builder.append(end_statement);
+			_append_indent(r_builder, p_indent, p_cur_indent);
+			r_builder.append("]");
 			p_markers.erase(a.id());
-			return s;
+			return;
 		}
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
 			Dictionary d = p_var;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), "\"{...}\"", "Converting circular structure to JSON.");
+			if (p_markers.has(d.id())) {
+				r_builder.append("\"{...}\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(d.id());
 
+			r_builder.append("{");
+			r_builder.append(end_statement);
+
 			List<Variant> keys;
 			d.get_key_list(&keys);
 
@@ -134,26 +157,160 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 				if (first_key) {
 					first_key = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_builder.append(",");
+					r_builder.append(end_statement);
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				s += colon;
-				s += _stringify(d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_append_indent(r_builder, p_indent, p_cur_indent + 1);
+				_stringify(r_builder, String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				r_builder.append(colon);
+				_stringify(r_builder, d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
+			r_builder.append(end_statement);
+			_append_indent(r_builder, p_indent, p_cur_indent);
+			r_builder.append("}");
 			p_markers.erase(d.id());
-			return s;
+			return;
 		}
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			r_builder.append("\"");
+			r_builder.append(String(p_var).json_escape());
+			r_builder.append("\"");
+			return;
+	}
+}
+
+template <typename C>
+static _FORCE_INLINE_ char32_t _json_peek(const C *p_str, int64_t p_index, int64_t p_len) {
+	// UTF-8 input isn't null terminated, so treat its end like the end of a String.
+	return p_index < p_len ? char32_t(p_str[p_index]) : 0;
+}
+
+// Characters of a string token are collected in the encoding of the input, and decoded once at the end.
+template <typename C>
+class JSONStringBuffer;
+
+template <>
+class JSONStringBuffer<char32_t> {
+	String str;
+
+public:
+	_FORCE_INLINE_ void append_run(const char32_t *p_run, int64_t p_len) { str += String(p_run, p_len); }
+	_FORCE_INLINE_ void append(char32_t p_char) { str += p_char; }
+	_FORCE_INLINE_ String get_string() const { return str; }
+};
+
+template <>
+class JSONStringBuffer<uint8_t> {
+	LocalVector<char> bytes;
+
+public:
+	void append_run(const uint8_t *p_run, int64_t p_len) {
+		uint32_t ofs = bytes.size();
+		bytes.resize(ofs + p_len);
+		memcpy(bytes.ptr() + ofs, p_run, p_len);
+	}
+	void append(char32_t p_char) {
+		if (p_char < 0x80) {
+			bytes.push_back(p_char);
+		} else if (p_char < 0x800) {
+			bytes.push_back(0xc0 | (p_char >> 6));
+			bytes.push_back(0x80 | (p_char & 0x3f));
+		} else if (p_char < 0x10000) {
+			bytes.push_back(0xe0 | (p_char >> 12));
+			bytes.push_back(0x80 | ((p_char >> 6) & 0x3f));
+			bytes.push_back(0x80 | (p_char & 0x3f));
+		} else {
+			bytes.push_back(0xf0 | (p_char >> 18));
+			bytes.push_back(0x80 | ((p_char >> 12) & 0x3f));
+			bytes.push_back(0x80 | ((p_char >> 6) & 0x3f));
+			bytes.push_back(0x80 | (p_char & 0x3f));
+		}
+	}
+	_FORCE_INLINE_ String get_string() const { return String::utf8(bytes.ptr(), bytes.size()); }
+};
+
+// Advances up to the next quote, escape sequence or end of the input, counting lines.
+template <typename C>
+static _FORCE_INLINE_ void _json_scan_string_run(const C *p_str, int64_t &r_index, int64_t p_len, int &r_line) {
+	while (true) {
+		char32_t c = _json_peek(p_str, r_index, p_len);
+		if (c == 0 || c == '"' || c == '\\') {
+			return;
+		}
+		if (c == '\n') {
+			r_line++;
+		}
+		r_index++;
+	}
+}
+
+static _FORCE_INLINE_ uint64_t _json_has_byte(uint64_t p_word, uint8_t p_byte) {
+	constexpr uint64_t ONES = 0x0101010101010101ULL;
+	const uint64_t x = p_word ^ (ONES * p_byte);
+	return (x - ONES) & ~x & (ONES << 7);
+}
+
+// UTF-8 runs are scanned 8 bytes at a time, skipping words without any byte that needs a look.
+template <>
+_FORCE_INLINE_ void _json_scan_string_run(const uint8_t *p_str, int64_t &r_index, int64_t p_len, int &r_line) {
+	while (true) {
+		while (r_index + 8 <= p_len) {
+			uint64_t word;
+			memcpy(&word, p_str + r_index, 8);
+			if (_json_has_byte(word, 0) | _json_has_byte(word, '"') | _json_has_byte(word, '\\') | _json_has_byte(word, '\n')) {
+				break;
+			}
+			r_index += 8;
+		}
+
+		char32_t c = _json_peek(p_str, r_index, p_len);
+		if (c == 0 || c == '"' || c == '\\') {
+			return;
+		}
+		if (c == '\n') {
+			r_line++;
+		}
+		r_index++;
+	}
+}
+
+static _FORCE_INLINE_ double _json_parse_number(const char32_t *p_str, int64_t &r_index, int64_t p_len) {
+	const char32_t *rptr;
+	double number = String::to_float(&p_str[r_index], &rptr);
+	r_index += (rptr - &p_str[r_index]);
+	return number;
+}
+
+static double _json_parse_number(const uint8_t *p_str, int64_t &r_index, int64_t p_len) {
+	// Numbers are ASCII, so the characters that may belong to one are widened and parsed like in a String.
+	int64_t end = r_index;
+	while (end < p_len && (is_ascii_alphanumeric_char(p_str[end]) || p_str[end] == '-' || p_str[end] == '+' || p_str[end] == '.')) {
+		end++;
+	}
+
+	char32_t small[64];
+	String large;
+	char32_t *digits = small;
+	if (end - r_index >= 64) {
+		large.resize(end - r_index + 1);
+		digits = large.ptrw();
+	}
+	for (int64_t i = r_index; i < end; i++) {
+		digits[i - r_index] = p_str[i];
 	}
+	digits[end - r_index] = 0;
+
+	const char32_t *rptr;
+	double number = String::to_float(digits, &rptr);
+	r_index += (rptr - digits);
+	return number;
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+template <typename C>
+Error JSON::_get_token(const C *p_str, int64_t &index, int64_t p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
-		switch (p_str[index]) {
+		switch (_json_peek(p_str, index, p_len)) {
 			case '\n': {
 				line++;
 				index++;
@@ -195,18 +352,19 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			}
 			case '"': {
 				index++;
-				String str;
+				JSONStringBuffer<C> str;
 				while (true) {
-					if (p_str[index] == 0) {
+					char32_t c = _json_peek(p_str, index, p_len);
+					if (c == 0) {
 						r_err_str = "Unterminated string";
 						return ERR_PARSE_ERROR;
-					} else if (p_str[index] == '"') {
+					} else if (c == '"') {
 						index++;
 						break;
-					} else if (p_str[index] == '\\') {
+					} else if (c == '\\') {
 						//escaped characters...
 						index++;
-						char32_t next = p_str[index];
+						char32_t next = _json_peek(p_str, index, p_len);
 						if (next == 0) {
 							r_err_str = "Unterminated string";
 							return ERR_PARSE_ERROR;
@@ -232,23 +390,23 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 							case 'u': {
 								// hex number
 								for (int j = 0; j < 4; j++) {
-									char32_t c = p_str[index + j + 1];
-									if (c == 0) {
+									char32_t h = _json_peek(p_str, index + j + 1, p_len);
+									if (h == 0) {
 										r_err_str = "Unterminated string";
 										return ERR_PARSE_ERROR;
 									}
-									if (!is_hex_digit(c)) {
+									if (!is_hex_digit(h)) {
 										r_err_str = "Malformed hex constant in string";
 										return ERR_PARSE_ERROR;
 									}
 									char32_t v;
-									if (is_digit(c)) {
-										v = c - '0';
-									} else if (c >= 'a' && c <= 'f') {
-										v = c - 'a';
+									if (is_digit(h)) {
+										v = h - '0';
+									} else if (h >= 'a' && h <= 'f') {
+										v = h - 'a';
 										v += 10;
-									} else if (c >= 'A' && c <= 'F') {
-										v = c - 'A';
+									} else if (h >= 'A' && h <= 'F') {
+										v = h - 'A';
 										v += 10;
 									} else {
 										ERR_PRINT("Bug parsing hex constant.");
@@ -261,30 +419,30 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 								index += 4; //will add at the end anyway
 
 								if ((res & 0xfffffc00) == 0xd800) {
-									if (p_str[index + 1] != '\\' || p_str[index + 2] != 'u') {
+									if (_json_peek(p_str, index + 1, p_len) != '\\' || _json_peek(p_str, index + 2, p_len) != 'u') {
 										r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
 										return ERR_PARSE_ERROR;
 									}
 									index += 2;
 									char32_t trail = 0;
 									for (int j = 0; j < 4; j++) {
-										char32_t c = p_str[index + j + 1];
-										if (c == 0) {
+										char32_t h = _json_peek(p_str, index + j + 1, p_len);
+										if (h == 0) {
 											r_err_str = "Unterminated string";
 											return ERR_PARSE_ERROR;
 										}
-										if (!is_hex_digit(c)) {
+										if (!is_hex_digit(h)) {
 											r_err_str = "Malformed hex constant in string";
 											return ERR_PARSE_ERROR;
 										}
 										char32_t v;
-										if (is_digit(c)) {
-											v = c - '0';
-										} else if (c >= 'a' && c <= 'f') {
-											v = c - 'a';
+										if (is_digit(h)) {
+											v = h - '0';
+										} else if (h >= 'a' && h <= 'f') {
+											v = h - 'a';
 											v += 10;
-										} else if (c >= 'A' && c <= 'F') {
-											v = c - 'A';
+										} else if (h >= 'A' && h <= 'F') {
+											v = h - 'A';
 											v += 10;
 										} else {
 											ERR_PRINT("Bug parsing hex constant.");
@@ -318,47 +476,46 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 							}
 						}
 
-						str += res;
+						str.append(res);
 
 					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+						// Add all the characters up to the next quote or escape sequence at once.
+						int64_t run_start = index;
+						_json_scan_string_run(p_str, index, p_len, line);
+						str.append_run(&p_str[run_start], index - run_start);
+						continue;
 					}
 					index++;
 				}
 
 				r_token.type = TK_STRING;
-				r_token.value = str;
+				r_token.value = str.get_string();
 				return OK;
 
 			} break;
 			default: {
-				if (p_str[index] <= 32) {
+				char32_t c = _json_peek(p_str, index, p_len);
+				if (c <= 32) {
 					index++;
 					break;
 				}
 
-				if (p_str[index] == '-' || is_digit(p_str[index])) {
+				if (c == '-' || is_digit(c)) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
 					r_token.type = TK_NUMBER;
-					r_token.value = number;
+					r_token.value = _json_parse_number(p_str, index, p_len);
 					return OK;
 
-				} else if (is_ascii_alphabet_char(p_str[index])) {
-					String id;
-
-					while (is_ascii_alphabet_char(p_str[index])) {
-						id += p_str[index];
+				} else if (is_ascii_alphabet_char(c)) {
+					int64_t id_start = index;
+					while (is_ascii_alphabet_char(_json_peek(p_str, index, p_len))) {
 						index++;
 					}
 
+					JSONStringBuffer<C> id;
+					id.append_run(&p_str[id_start], index - id_start);
 					r_token.type = TK_IDENTIFIER;
-					r_token.value = id;
+					r_token.value = id.get_string();
 					return OK;
 				} else {
 					r_err_str = "Unexpected character";
@@ -372,42 +529,52 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+#define JSON_NOTIFY(m_call)                     \
+	{                                           \
+		Error notify_err = m_call;              \
+		if (unlikely(notify_err != OK)) {       \
+			r_err_str = "Stopped by listener";  \
+			return notify_err;                  \
+		}                                       \
+	}
+
+template <typename C, typename H>
+Error JSON::_parse_value(H &p_handler, Token &token, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep";
 		return ERR_OUT_OF_MEMORY;
 	}
 
 	if (token.type == TK_CURLY_BRACKET_OPEN) {
-		Dictionary d;
-		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		JSON_NOTIFY(p_handler.begin_object());
+		Error err = _parse_object(p_handler, p_str, index, p_len, line, p_depth + 1, r_err_str);
 		if (err) {
 			return err;
 		}
-		value = d;
+		JSON_NOTIFY(p_handler.end_object());
 	} else if (token.type == TK_BRACKET_OPEN) {
-		Array a;
-		Error err = _parse_array(a, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		JSON_NOTIFY(p_handler.begin_array());
+		Error err = _parse_array(p_handler, p_str, index, p_len, line, p_depth + 1, r_err_str);
 		if (err) {
 			return err;
 		}
-		value = a;
+		JSON_NOTIFY(p_handler.end_array());
 	} else if (token.type == TK_IDENTIFIER) {
 		String id = token.value;
 		if (id == "true") {
-			value = true;
+			JSON_NOTIFY(p_handler.value(true));
 		} else if (id == "false") {
-			value = false;
+			JSON_NOTIFY(p_handler.value(false));
 		} else if (id == "null") {
-			value = Variant();
+			JSON_NOTIFY(p_handler.value(Variant()));
 		} else {
 			r_err_str = vformat("Expected 'true', 'false', or 'null', got '%s'", id);
 			return ERR_PARSE_ERROR;
 		}
 	} else if (token.type == TK_NUMBER) {
-		value = token.value;
+		JSON_NOTIFY(p_handler.value(token.value));
 	} else if (token.type == TK_STRING) {
-		value = token.value;
+		JSON_NOTIFY(p_handler.value(token.value));
 	} else {
 		r_err_str = vformat("Expected value, got '%s'", String(tk_name[token.type]));
 		return ERR_PARSE_ERROR;
@@ -416,7 +583,8 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C, typename H>
+Error JSON::_parse_array(H &p_handler, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str) {
 	Token token;
 	bool need_comma = false;
 
@@ -440,13 +608,11 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 			}
 		}
 
-		Variant v;
-		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+		err = _parse_value(p_handler, token, p_str, index, p_len, line, p_depth, r_err_str);
 		if (err) {
 			return err;
 		}
 
-		array.push_back(v);
 		need_comma = true;
 	}
 
@@ -454,9 +620,9 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C, typename H>
+Error JSON::_parse_object(H &p_handler, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str) {
 	bool at_key = true;
-	String key;
 	Token token;
 	bool need_comma = false;
 
@@ -486,7 +652,7 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 				return ERR_PARSE_ERROR;
 			}
 
-			key = token.value;
+			String key = token.value;
 			err = _get_token(p_str, index, p_len, token, line, r_err_str);
 			if (err != OK) {
 				return err;
@@ -495,6 +661,7 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 				r_err_str = "Expected ':'";
 				return ERR_PARSE_ERROR;
 			}
+			JSON_NOTIFY(p_handler.key(key));
 			at_key = false;
 		} else {
 			Error err = _get_token(p_str, index, p_len, token, line, r_err_str);
@@ -502,12 +669,10 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 				return err;
 			}
 
-			Variant v;
-			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+			err = _parse_value(p_handler, token, p_str, index, p_len, line, p_depth, r_err_str);
 			if (err) {
 				return err;
 			}
-			object[key] = v;
 			need_comma = true;
 			at_key = true;
 		}
@@ -517,35 +682,28 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 	return ERR_PARSE_ERROR;
 }
 
-void JSON::set_data(const Variant &p_data) {
-	data = p_data;
-	text.clear();
-}
+#undef JSON_NOTIFY
 
-Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
-	int idx = 0;
-	int len = p_json.length();
+template <typename C, typename H>
+Error JSON::_parse(H &p_handler, const C *p_str, int64_t p_len, String &r_err_str, int &r_err_line) {
+	int64_t idx = 0;
 	Token token;
 	r_err_line = 0;
-	String aux_key;
 
-	Error err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	Error err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 	if (err) {
 		return err;
 	}
 
-	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, r_err_str);
+	err = _parse_value(p_handler, token, p_str, idx, p_len, r_err_line, 0, r_err_str);
 
 	// Check if EOF is reached
 	// or it's a type of the next token.
-	if (err == OK && idx < len) {
-		err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	if (err == OK && idx < p_len) {
+		err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 
 		if (err || token.type != TK_EOF) {
 			r_err_str = "Expected 'EOF'";
-			// Reset return value to empty `Variant`
-			r_ret = Variant();
 			return ERR_PARSE_ERROR;
 		}
 	}
@@ -553,6 +711,99 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	return err;
 }
 
+// Builds the parsed document as a Variant.
+class JSONVariantBuilder {
+	struct Container {
+		Variant container;
+		String key;
+	};
+	LocalVector<Container> stack;
+
+	_FORCE_INLINE_ void _push(const Variant &p_container) {
+		stack.push_back(Container());
+		stack[stack.size() - 1].container = p_container;
+	}
+
+	_FORCE_INLINE_ Error _pop() {
+		Variant container = stack[stack.size() - 1].container;
+		stack.resize(stack.size() - 1);
+		return value(container);
+	}
+
+public:
+	Variant result;
+	bool complete = false;
+
+	_FORCE_INLINE_ Error begin_object() {
+		_push(Dictionary());
+		return OK;
+	}
+	_FORCE_INLINE_ Error end_object() { return _pop(); }
+	_FORCE_INLINE_ Error begin_array() {
+		_push(Array());
+		return OK;
+	}
+	_FORCE_INLINE_ Error end_array() { return _pop(); }
+	_FORCE_INLINE_ Error key(const String &p_key) {
+		stack[stack.size() - 1].key = p_key;
+		return OK;
+	}
+	Error value(const Variant &p_value) {
+		if (stack.is_empty()) {
+			result = p_value;
+			complete = true;
+			return OK;
+		}
+		Container &top = stack[stack.size() - 1];
+		if (top.container.get_type() == Variant::ARRAY) {
+			VariantInternal::get_array(&top.container)->push_back(p_value);
+		} else {
+			(*VariantInternal::get_dictionary(&top.container))[top.key] = p_value;
+		}
+		return OK;
+	}
+};
+
+// Forwards the parsed document to a listener.
+class JSONListenerHandler {
+	JSON::ParseListener &listener;
+
+public:
+	_FORCE_INLINE_ Error begin_object() { return listener.begin_object(); }
+	_FORCE_INLINE_ Error end_object() { return listener.end_object(); }
+	_FORCE_INLINE_ Error begin_array() { return listener.begin_array(); }
+	_FORCE_INLINE_ Error end_array() { return listener.end_array(); }
+	_FORCE_INLINE_ Error key(const String &p_key) { return listener.object_key(p_key); }
+	_FORCE_INLINE_ Error value(const Variant &p_value) { return listener.value(p_value); }
+
+	JSONListenerHandler(JSON::ParseListener &p_listener) :
+			listener(p_listener) {}
+};
+
+static void _json_skip_bom(const uint8_t *&r_utf8, int64_t &r_size) {
+	if (r_size >= 3 && r_utf8[0] == 0xef && r_utf8[1] == 0xbb && r_utf8[2] == 0xbf) {
+		r_utf8 += 3;
+		r_size -= 3;
+	}
+}
+
+void JSON::set_data(const Variant &p_data) {
+	data = p_data;
+	text.clear();
+}
+
+Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	JSONVariantBuilder builder;
+	Error err = _parse(builder, p_json.ptr(), p_json.length(), r_err_str, r_err_line);
+	if (err == OK) {
+		r_ret = builder.result;
+	} else if (builder.complete) {
+		// Failed after the value, expecting EOF. Reset return value to empty `Variant`.
+		r_ret = Variant();
+	}
+	return err;
+}
+
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	Error err = _parse_string(p_json_string, data, err_str, err_line);
 	if (err == Error::OK) {
@@ -564,6 +815,53 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_utf8(const uint8_t *p_utf8, int64_t p_size, bool p_keep_text) {
+	if (p_keep_text) {
+		text.parse_utf8((const char *)p_utf8, p_size);
+	}
+	_json_skip_bom(p_utf8, p_size);
+
+	JSONVariantBuilder builder;
+	Error err = _parse(builder, p_utf8, p_size, err_str, err_line);
+	if (err == OK) {
+		data = builder.result;
+		err_line = 0;
+	} else if (builder.complete) {
+		data = Variant();
+	}
+	return err;
+}
+
+Error JSON::parse_events(const String &p_json_string, ParseListener &p_listener, String *r_err_str, int *r_err_line) {
+	JSONListenerHandler handler(p_listener);
+	String err_str;
+	int err_line = 0;
+	Error err = _parse(handler, p_json_string.ptr(), p_json_string.length(), err_str, err_line);
+	if (r_err_str) {
+		*r_err_str = err == OK ? String() : err_str;
+	}
+	if (r_err_line) {
+		*r_err_line = err == OK ? 0 : err_line;
+	}
+	return err;
+}
+
+Error JSON::parse_utf8_events(const uint8_t *p_utf8, int64_t p_size, ParseListener &p_listener, String *r_err_str, int *r_err_line) {
+	_json_skip_bom(p_utf8, p_size);
+
+	JSONListenerHandler handler(p_listener);
+	String err_str;
+	int err_line = 0;
+	Error err = _parse(handler, p_utf8, p_size, err_str, err_line);
+	if (r_err_str) {
+		*r_err_str = err == OK ? String() : err_str;
+	}
+	if (r_err_line) {
+		*r_err_line = err == OK ? 0 : err_line;
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
@@ -572,7 +870,9 @@ String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort
 	Ref<JSON> json;
 	json.instantiate();
 	HashSet<const void *> markers;
-	return json->_stringify(p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	StringBuilder builder;
+	json->_stringify(builder, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return builder.as_string();
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -1619,7 +1919,9 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	// Parse the bytes directly, instead of decoding the whole file to a String first.
+	Vector<uint8_t> bytes = FileAccess::get_file_as_bytes(p_path);
+	Error err = json->parse_utf8(bytes.ptr(), bytes.size(), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
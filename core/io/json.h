@@ -34,6 +34,7 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/string/string_builder.h"
 #include "core/variant/variant.h"
 
 class JSON : public Resource {
@@ -72,12 +73,19 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static String _make_indent(const String &p_indent, int p_size);
-	static String _stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	static void _append_indent(StringBuilder &r_builder, const String &p_indent, int p_size);
+	static void _stringify(StringBuilder &r_builder, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
+	// Shared by the String and UTF-8 parsers, which build a Variant or notify a listener.
+	template <typename C>
+	static Error _get_token(const C *p_str, int64_t &index, int64_t p_len, Token &r_token, int &line, String &r_err_str);
+	template <typename C, typename H>
+	static Error _parse_value(H &p_handler, Token &token, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C, typename H>
+	static Error _parse_array(H &p_handler, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C, typename H>
+	static Error _parse_object(H &p_handler, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C, typename H>
+	static Error _parse(H &p_handler, const C *p_str, int64_t p_len, String &r_err_str, int &r_err_line);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 	static Variant _from_native(const Variant &p_variant, bool p_full_objects, int p_depth);
@@ -87,11 +95,28 @@ protected:
 	static void _bind_methods();
 
 public:
+	// Receives the contents of a document in order as it's parsed, instead of a Variant holding all of it.
+	// Returning an error from any of the callbacks stops parsing with that error.
+	class ParseListener {
+	public:
+		virtual Error begin_object() { return OK; }
+		virtual Error end_object() { return OK; }
+		virtual Error begin_array() { return OK; }
+		virtual Error end_array() { return OK; }
+		virtual Error object_key(const String &p_key) { return OK; }
+		virtual Error value(const Variant &p_value) { return OK; }
+
+		virtual ~ParseListener() {}
+	};
+
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8(const uint8_t *p_utf8, int64_t p_size, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
+	static Error parse_events(const String &p_json_string, ParseListener &p_listener, String *r_err_str = nullptr, int *r_err_line = nullptr);
+	static Error parse_utf8_events(const uint8_t *p_utf8, int64_t p_size, ParseListener &p_listener, String *r_err_str = nullptr, int *r_err_line = nullptr);
 
 	_FORCE_INLINE_ static Variant from_native(const Variant &p_variant, bool p_full_objects = false) {
 		return _from_native(p_variant, p_full_objects, 0);
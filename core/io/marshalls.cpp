@@ -56,6 +56,56 @@ ObjectID EncodedObjectAsID::get_object_id() const {
 #define ERR_FAIL_ADD_OF(a, b, err) ERR_FAIL_COND_V(((int32_t)(b)) < 0 || ((int32_t)(a)) < 0 || ((int32_t)(a)) > INT_MAX - ((int32_t)(b)), err)
 #define ERR_FAIL_MUL_OF(a, b, err) ERR_FAIL_COND_V(((int32_t)(a)) < 0 || ((int32_t)(b)) <= 0 || ((int32_t)(a)) > INT_MAX / ((int32_t)(b)), err)
 
+// Packed arrays are stored as consecutive little-endian 32 or 64-bit components, which is already
+// their layout in memory on little-endian hosts, so they can be copied in bulk.
+static void _encode_array_32(const void *p_src, int64_t p_count, uint8_t *p_dst) {
+#ifdef BIG_ENDIAN_ENABLED
+	const uint32_t *src = (const uint32_t *)p_src;
+	for (int64_t i = 0; i < p_count; i++) {
+		encode_uint32(src[i], p_dst + i * sizeof(uint32_t));
+	}
+#else
+	if (p_count > 0) {
+		memcpy(p_dst, p_src, p_count * sizeof(uint32_t));
+	}
+#endif
+}
+
+static void _encode_array_64(const void *p_src, int64_t p_count, uint8_t *p_dst) {
+#ifdef BIG_ENDIAN_ENABLED
+	const uint64_t *src = (const uint64_t *)p_src;
+	for (int64_t i = 0; i < p_count; i++) {
+		encode_uint64(src[i], p_dst + i * sizeof(uint64_t));
+	}
+#else
+	if (p_count > 0) {
+		memcpy(p_dst, p_src, p_count * sizeof(uint64_t));
+	}
+#endif
+}
+
+static void _decode_array_32(const uint8_t *p_src, int64_t p_count, void *p_dst) {
+#ifdef BIG_ENDIAN_ENABLED
+	uint32_t *dst = (uint32_t *)p_dst;
+	for (int64_t i = 0; i < p_count; i++) {
+		dst[i] = decode_uint32(p_src + i * sizeof(uint32_t));
+	}
+#else
+	memcpy(p_dst, p_src, p_count * sizeof(uint32_t));
+#endif
+}
+
+static void _decode_array_64(const uint8_t *p_src, int64_t p_count, void *p_dst) {
+#ifdef BIG_ENDIAN_ENABLED
+	uint64_t *dst = (uint64_t *)p_dst;
+	for (int64_t i = 0; i < p_count; i++) {
+		dst[i] = decode_uint64(p_src + i * sizeof(uint64_t));
+	}
+#else
+	memcpy(p_dst, p_src, p_count * sizeof(uint64_t));
+#endif
+}
+
 // Byte 0: `Variant::Type`, byte 1: unused, bytes 2 and 3: additional data.
 #define HEADER_TYPE_MASK 0xFF
 
@@ -928,10 +978,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				memcpy(data.ptrw(), buf, count);
 			}
 
 			r_variant = data;
@@ -955,12 +1002,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int32_t> data;
 
 			if (count) {
-				//const int *rbuf = (const int *)buf;
 				data.resize(count);
-				int32_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_uint32(&buf[i * 4]);
-				}
+				_decode_array_32(buf, count, data.ptrw());
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -979,12 +1022,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int64_t> data;
 
 			if (count) {
-				//const int *rbuf = (const int *)buf;
 				data.resize(count);
-				int64_t *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_uint64(&buf[i * 8]);
-				}
+				_decode_array_64(buf, count, data.ptrw());
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -1003,12 +1042,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<float> data;
 
 			if (count) {
-				//const float *rbuf = (const float *)buf;
 				data.resize(count);
-				float *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_float(&buf[i * 4]);
-				}
+				_decode_array_32(buf, count, data.ptrw());
 			}
 			r_variant = data;
 
@@ -1029,10 +1064,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				double *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_double(&buf[i * 8]);
-				}
+				_decode_array_64(buf, count, data.ptrw());
 			}
 			r_variant = data;
 
@@ -1086,9 +1118,13 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
-					for (int32_t i = 0; i < count; i++) {
-						w[i].x = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 0);
-						w[i].y = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 1);
+					if (sizeof(real_t) == sizeof(double)) {
+						_decode_array_64(buf, count * 2, w);
+					} else {
+						for (int32_t i = 0; i < count; i++) {
+							w[i].x = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 0);
+							w[i].y = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 1);
+						}
 					}
 
 					int adv = sizeof(double) * 2 * count;
@@ -1111,9 +1147,13 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
-					for (int32_t i = 0; i < count; i++) {
-						w[i].x = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 0);
-						w[i].y = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 1);
+					if (sizeof(real_t) == sizeof(float)) {
+						_decode_array_32(buf, count * 2, w);
+					} else {
+						for (int32_t i = 0; i < count; i++) {
+							w[i].x = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 0);
+							w[i].y = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 1);
+						}
 					}
 
 					int adv = sizeof(float) * 2 * count;
@@ -1146,10 +1186,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
-					for (int32_t i = 0; i < count; i++) {
-						w[i].x = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 0);
-						w[i].y = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 1);
-						w[i].z = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 2);
+					if (sizeof(real_t) == sizeof(double)) {
+						_decode_array_64(buf, count * 3, w);
+					} else {
+						for (int32_t i = 0; i < count; i++) {
+							w[i].x = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 0);
+							w[i].y = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 1);
+							w[i].z = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 2);
+						}
 					}
 
 					int adv = sizeof(double) * 3 * count;
@@ -1172,10 +1216,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
-					for (int32_t i = 0; i < count; i++) {
-						w[i].x = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 0);
-						w[i].y = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 1);
-						w[i].z = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 2);
+					if (sizeof(real_t) == sizeof(float)) {
+						_decode_array_32(buf, count * 3, w);
+					} else {
+						for (int32_t i = 0; i < count; i++) {
+							w[i].x = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 0);
+							w[i].y = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 1);
+							w[i].z = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 2);
+						}
 					}
 
 					int adv = sizeof(float) * 3 * count;
@@ -1207,15 +1255,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				carray.resize(count);
-				Color *w = carray.ptrw();
-
-				for (int32_t i = 0; i < count; i++) {
-					// Colors should always be in single-precision.
-					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
-					w[i].g = decode_float(buf + i * 4 * 4 + 4 * 1);
-					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
-					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
-				}
+				// Colors should always be in single-precision.
+				_decode_array_32(buf, count * 4, carray.ptrw());
 
 				int adv = 4 * 4 * count;
 
@@ -1248,11 +1289,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector4 *w = varray.ptrw();
 
-					for (int32_t i = 0; i < count; i++) {
-						w[i].x = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 0);
-						w[i].y = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 1);
-						w[i].z = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 2);
-						w[i].w = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 3);
+					if (sizeof(real_t) == sizeof(double)) {
+						_decode_array_64(buf, count * 4, w);
+					} else {
+						for (int32_t i = 0; i < count; i++) {
+							w[i].x = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 0);
+							w[i].y = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 1);
+							w[i].z = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 2);
+							w[i].w = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 3);
+						}
 					}
 
 					int adv = sizeof(double) * 4 * count;
@@ -1275,11 +1320,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector4 *w = varray.ptrw();
 
-					for (int32_t i = 0; i < count; i++) {
-						w[i].x = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 0);
-						w[i].y = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 1);
-						w[i].z = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 2);
-						w[i].w = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 3);
+					if (sizeof(real_t) == sizeof(float)) {
+						_decode_array_32(buf, count * 4, w);
+					} else {
+						for (int32_t i = 0; i < count; i++) {
+							w[i].x = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 0);
+							w[i].y = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 1);
+							w[i].z = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 2);
+							w[i].w = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 3);
+						}
 					}
 
 					int adv = sizeof(float) * 4 * count;
@@ -1935,10 +1984,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int32_t *r = data.ptr();
-				for (int32_t i = 0; i < datalen; i++) {
-					encode_uint32(r[i], &buf[i * datasize]);
-				}
+				_encode_array_32(data.ptr(), datalen, buf);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1952,10 +1998,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int64_t *r = data.ptr();
-				for (int64_t i = 0; i < datalen; i++) {
-					encode_uint64(r[i], &buf[i * datasize]);
-				}
+				_encode_array_64(data.ptr(), datalen, buf);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1969,10 +2012,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const float *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_float(r[i], &buf[i * datasize]);
-				}
+				_encode_array_32(data.ptr(), datalen, buf);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1986,10 +2026,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const double *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_double(r[i], &buf[i * datasize]);
-				}
+				_encode_array_64(data.ptr(), datalen, buf);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -2038,13 +2075,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Vector2 v = data.get(i);
-
-					encode_real(v.x, &buf[0]);
-					encode_real(v.y, &buf[sizeof(real_t)]);
-					buf += sizeof(real_t) * 2;
+				if (sizeof(real_t) == sizeof(double)) {
+					_encode_array_64(data.ptr(), len * 2, buf);
+				} else {
+					_encode_array_32(data.ptr(), len * 2, buf);
 				}
+				buf += sizeof(real_t) * 2 * len;
 			}
 
 			r_len += sizeof(real_t) * 2 * len;
@@ -2062,14 +2098,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Vector3 v = data.get(i);
-
-					encode_real(v.x, &buf[0]);
-					encode_real(v.y, &buf[sizeof(real_t)]);
-					encode_real(v.z, &buf[sizeof(real_t) * 2]);
-					buf += sizeof(real_t) * 3;
+				if (sizeof(real_t) == sizeof(double)) {
+					_encode_array_64(data.ptr(), len * 3, buf);
+				} else {
+					_encode_array_32(data.ptr(), len * 3, buf);
 				}
+				buf += sizeof(real_t) * 3 * len;
 			}
 
 			r_len += sizeof(real_t) * 3 * len;
@@ -2087,15 +2121,8 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Color c = data.get(i);
-
-					encode_float(c.r, &buf[0]);
-					encode_float(c.g, &buf[4]);
-					encode_float(c.b, &buf[8]);
-					encode_float(c.a, &buf[12]);
-					buf += 4 * 4; // Colors should always be in single-precision.
-				}
+				_encode_array_32(data.ptr(), len * 4, buf);
+				buf += 4 * 4 * len; // Colors should always be in single-precision.
 			}
 
 			r_len += 4 * 4 * len;
@@ -2113,15 +2140,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Vector4 v = data.get(i);
-
-					encode_real(v.x, &buf[0]);
-					encode_real(v.y, &buf[sizeof(real_t)]);
-					encode_real(v.z, &buf[sizeof(real_t) * 2]);
-					encode_real(v.w, &buf[sizeof(real_t) * 3]);
-					buf += sizeof(real_t) * 4;
+				if (sizeof(real_t) == sizeof(double)) {
+					_encode_array_64(data.ptr(), len * 4, buf);
+				} else {
+					_encode_array_32(data.ptr(), len * 4, buf);
 				}
+				buf += sizeof(real_t) * 4 * len;
 			}
 
 			r_len += sizeof(real_t) * 4 * len;
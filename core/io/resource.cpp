@@ -436,6 +436,10 @@ RID Resource::get_rid() const {
 	return ret;
 }
 
+uint64_t Resource::get_memory_usage() const {
+	return 0;
+}
+
 #ifdef TOOLS_ENABLED
 
 uint32_t Resource::hash_edited_version_for_preview() const {
@@ -543,6 +547,7 @@ void Resource::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_name", "name"), &Resource::set_name);
 	ClassDB::bind_method(D_METHOD("get_name"), &Resource::get_name);
 	ClassDB::bind_method(D_METHOD("get_rid"), &Resource::get_rid);
+	ClassDB::bind_method(D_METHOD("get_memory_usage"), &Resource::get_memory_usage);
 	ClassDB::bind_method(D_METHOD("set_local_to_scene", "enable"), &Resource::set_local_to_scene);
 	ClassDB::bind_method(D_METHOD("is_local_to_scene"), &Resource::is_local_to_scene);
 	ClassDB::bind_method(D_METHOD("get_local_scene"), &Resource::get_local_scene);
@@ -598,12 +603,19 @@ HashMap<String, Resource *> ResourceCache::resources;
 HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
 
+List<ResourceCache::SoftCacheEntry> ResourceCache::soft_cache;
+HashMap<Resource *, List<ResourceCache::SoftCacheEntry>::Element *> ResourceCache::soft_cache_elements;
+uint64_t ResourceCache::soft_cache_budget = 0;
+uint64_t ResourceCache::soft_cache_memory_usage = 0;
+
 Mutex ResourceCache::lock;
 #ifdef TOOLS_ENABLED
 RWLock ResourceCache::path_cache_lock;
 #endif
 
 void ResourceCache::clear() {
+	soft_cache_clear();
+
 	if (!resources.is_empty()) {
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			ERR_PRINT(vformat("%d resources still in use at exit.", resources.size()));
@@ -657,6 +669,10 @@ Ref<Resource> ResourceCache::get_ref(const String &p_path) {
 			resources.erase(p_path);
 			res = nullptr;
 		}
+
+		if (ref.is_valid() && soft_cache_budget) {
+			_soft_cache_touch(ref.ptr());
+		}
 	}
 
 	return ref;
@@ -689,3 +705,104 @@ int ResourceCache::get_cached_resource_count() {
 	MutexLock mutex_lock(lock);
 	return resources.size();
 }
+
+uint64_t ResourceCache::get_cached_memory_usage() {
+	uint64_t total = 0;
+	LocalVector<Ref<Resource>> refs; // Released after unlocking, since that may free them.
+
+	{
+		MutexLock mutex_lock(lock);
+		refs.reserve(resources.size());
+		for (const KeyValue<String, Resource *> &E : resources) {
+			Ref<Resource> ref = Ref<Resource>(E.value);
+			if (ref.is_valid()) { // Otherwise, it's in the process of being deleted.
+				total += ref->get_memory_usage();
+				refs.push_back(ref);
+			}
+		}
+	}
+
+	return total;
+}
+
+// Must be called with the lock held.
+void ResourceCache::_soft_cache_touch(Resource *p_resource) {
+	List<SoftCacheEntry>::Element **E = soft_cache_elements.getptr(p_resource);
+	if (E) {
+		soft_cache.move_to_front(*E);
+	}
+}
+
+// Must be called with the lock held. The evicted references must be released
+// only after unlocking, as that may free the resources.
+void ResourceCache::_soft_cache_trim(LocalVector<Ref<Resource>> &r_evicted) {
+	while (soft_cache_memory_usage > soft_cache_budget && soft_cache.back()) {
+		List<SoftCacheEntry>::Element *E = soft_cache.back();
+		soft_cache_memory_usage -= E->get().memory_usage;
+		soft_cache_elements.erase(E->get().resource.ptr());
+		r_evicted.push_back(E->get().resource);
+		soft_cache.erase(E);
+	}
+}
+
+void ResourceCache::soft_cache_retain(const Ref<Resource> &p_resource) {
+	ERR_FAIL_COND(p_resource.is_null());
+
+	LocalVector<Ref<Resource>> evicted;
+	{
+		MutexLock mutex_lock(lock);
+		if (!soft_cache_budget) {
+			return;
+		}
+
+		// Estimate again, in case the resource changed since it was retained.
+		uint64_t memory_usage = p_resource->get_memory_usage();
+		List<SoftCacheEntry>::Element **E = soft_cache_elements.getptr(p_resource.ptr());
+		if (E) {
+			soft_cache_memory_usage -= (*E)->get().memory_usage;
+			(*E)->get().memory_usage = memory_usage;
+			soft_cache.move_to_front(*E);
+		} else {
+			SoftCacheEntry entry;
+			entry.resource = p_resource;
+			entry.memory_usage = memory_usage;
+			soft_cache_elements.insert(p_resource.ptr(), soft_cache.push_front(entry));
+		}
+		soft_cache_memory_usage += memory_usage;
+
+		_soft_cache_trim(evicted);
+	}
+}
+
+void ResourceCache::soft_cache_clear() {
+	LocalVector<Ref<Resource>> evicted;
+	{
+		MutexLock mutex_lock(lock);
+		evicted.reserve(soft_cache.size());
+		for (const SoftCacheEntry &entry : soft_cache) {
+			evicted.push_back(entry.resource);
+		}
+		soft_cache.clear();
+		soft_cache_elements.clear();
+		soft_cache_memory_usage = 0;
+	}
+}
+
+void ResourceCache::set_soft_cache_budget(uint64_t p_bytes) {
+	LocalVector<Ref<Resource>> evicted;
+	{
+		MutexLock mutex_lock(lock);
+		soft_cache_budget = p_bytes;
+		_soft_cache_trim(evicted);
+	}
+}
+
+uint64_t ResourceCache::get_soft_cache_budget() {
+	MutexLock mutex_lock(lock);
+	return soft_cache_budget;
+}
+
+uint64_t ResourceCache::get_soft_cache_memory_usage() {
+	MutexLock mutex_lock(lock);
+	return soft_cache_memory_usage;
+}
@@ -151,6 +151,7 @@ public:
 	void set_as_translation_remapped(bool p_remapped);
 
 	virtual RID get_rid() const; // some resources may offer conversion to RID
+	virtual uint64_t get_memory_usage() const; // Estimate, in bytes, of the data kept alive by this resource.
 
 	//helps keep IDs same number when loading/saving scenes. -1 clears ID and it Returns -1 when no id stored
 	void set_id_for_path(const String &p_path, const String &p_id);
@@ -173,11 +174,32 @@ class ResourceCache {
 	static void clear();
 	friend void register_core_types();
 
+	// The soft cache keeps recently used resources alive, even if nothing else
+	// references them, as long as their estimated memory fits in the budget.
+	struct SoftCacheEntry {
+		Ref<Resource> resource;
+		uint64_t memory_usage = 0;
+	};
+	static List<SoftCacheEntry> soft_cache; // Most recently used first.
+	static HashMap<Resource *, List<SoftCacheEntry>::Element *> soft_cache_elements;
+	static uint64_t soft_cache_budget;
+	static uint64_t soft_cache_memory_usage;
+
+	static void _soft_cache_touch(Resource *p_resource);
+	static void _soft_cache_trim(LocalVector<Ref<Resource>> &r_evicted);
+
 public:
 	static bool has(const String &p_path);
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+	static uint64_t get_cached_memory_usage();
+
+	static void soft_cache_retain(const Ref<Resource> &p_resource);
+	static void soft_cache_clear();
+	static void set_soft_cache_budget(uint64_t p_bytes);
+	static uint64_t get_soft_cache_budget();
+	static uint64_t get_soft_cache_memory_usage();
 };
 
 #endif // RESOURCE_H
@@ -336,12 +336,14 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 void ResourceLoader::_run_load_task(void *p_userdata) {
 	ThreadLoadTask &load_task = *(ThreadLoadTask *)p_userdata;
 
+	bool cancelled = false;
 	{
 		MutexLock thread_load_lock(thread_load_mutex);
 		if (cleaning_tasks) {
 			load_task.status = THREAD_LOAD_FAILED;
 			return;
 		}
+		cancelled = load_task.cancelled;
 	}
 
 	ThreadLoadTask *curr_load_task_backup = curr_load_task;
@@ -366,7 +368,14 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	const String &remapped_path = _path_remap(load_task.local_path, &xl_remapped);
 
 	Error load_err = OK;
-	Ref<Resource> res = _load(remapped_path, remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_err, load_task.use_sub_threads, &load_task.progress);
+	Ref<Resource> res;
+	if (unlikely(cancelled)) {
+		// Cancelled while waiting to be run. Skip the load, but complete the task as usual.
+		print_verbose(vformat("Skipping cancelled load of resource: %s", load_task.local_path));
+		load_err = ERR_SKIP;
+	} else {
+		res = _load(remapped_path, remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_err, load_task.use_sub_threads, &load_task.progress);
+	}
 	if (MessageQueue::get_singleton() != MessageQueue::get_main_singleton()) {
 		MessageQueue::get_singleton()->flush();
 	}
@@ -421,6 +430,7 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 			if (pending_unlock) {
 				ResourceCache::lock.unlock();
 			}
+			ResourceCache::soft_cache_retain(load_task.resource);
 		} else {
 			load_task.resource->set_path_cache(load_task.local_path);
 		}
@@ -486,8 +496,8 @@ static String _validate_local_path(const String &p_path) {
 	}
 }
 
-Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode) {
-	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, true);
+Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode, LoadPriority p_priority) {
+	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, true, p_priority);
 	return token.is_valid() ? OK : FAILED;
 }
 
@@ -536,17 +546,26 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 	return res;
 }
 
-Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user) {
+Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user, LoadPriority p_priority) {
 	String local_path = _validate_local_path(p_path);
 
 	bool ignoring_cache = p_cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE || p_cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE_DEEP;
 
 	Ref<LoadToken> load_token;
 	bool must_not_register = false;
+	bool replacing_cancelled = false;
 	ThreadLoadTask *load_task_ptr = nullptr;
 	{
 		MutexLock thread_load_lock(thread_load_mutex);
 
+		// Dependencies are loaded with the priority of the load that needs them, and are tracked
+		// so cancelling it can be propagated to them.
+		ThreadLoadTask *parent_task = p_for_user ? nullptr : curr_load_task;
+		if (parent_task) {
+			p_priority = MAX(p_priority, parent_task->priority);
+			parent_task->dependency_tasks.insert(local_path);
+		}
+
 		if (p_for_user) {
 			LoadToken *existing_token = _load_threaded_request_reuse_user_token(p_path);
 			if (existing_token) {
@@ -555,18 +574,25 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		}
 
 		if (!ignoring_cache && thread_load_tasks.has(local_path)) {
-			load_token = Ref<LoadToken>(thread_load_tasks[local_path].load_token);
+			ThreadLoadTask &existing_task = thread_load_tasks[local_path];
+			load_token = Ref<LoadToken>(existing_task.load_token);
 			if (load_token.is_valid()) {
-				if (p_for_user) {
-					// Load task exists, with no user tokens at the moment.
-					// Let's "attach" to it.
-					_load_threaded_request_setup_user_token(load_token.ptr(), p_path);
+				if (!existing_task.cancelled) {
+					if (p_for_user) {
+						// Load task exists, with no user tokens at the moment.
+						// Let's "attach" to it.
+						_load_threaded_request_setup_user_token(load_token.ptr(), p_path);
+					}
+					return load_token;
 				}
-				return load_token;
+				// A cancelled load can't be revived, since its runner may have already seen the flag
+				// and be completing with ERR_SKIP. Let it drain and start an unregistered one below.
+				load_token.unref();
+				replacing_cancelled = true;
 			} else {
 				// The token is dying (reached 0 on another thread).
 				// Ensure it's killed now so the path can be safely reused right away.
-				thread_load_tasks[local_path].load_token->clear();
+				existing_task.load_token->clear();
 			}
 		}
 
@@ -585,7 +611,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
-			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
+			load_task.priority = p_priority;
+			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && !replacing_cancelled) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
 					//referencing is fine
@@ -599,7 +626,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			}
 
 			// If we want to ignore cache, but there's another task loading it, we can't add this one to the map.
-			must_not_register = ignoring_cache && thread_load_tasks.has(local_path);
+			// The same applies if the one there is a cancelled load still draining.
+			must_not_register = (ignoring_cache || replacing_cancelled) && thread_load_tasks.has(local_path);
 			if (must_not_register) {
 				load_token->task_if_unregistered = memnew(ThreadLoadTask(load_task));
 				load_task_ptr = load_token->task_if_unregistered;
@@ -624,7 +652,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 				load_task_ptr->thread_id = Thread::get_caller_id();
 			}
 		} else {
-			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, load_task_ptr);
+			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, load_task_ptr, p_priority == LOAD_PRIORITY_HIGH);
 		}
 	} // MutexLock(thread_load_mutex).
 
@@ -747,6 +775,66 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 	return res;
 }
 
+Error ResourceLoader::load_threaded_cancel(const String &p_path) {
+	MutexLock thread_load_lock(thread_load_mutex);
+
+	if (!user_load_tokens.has(p_path)) {
+		print_verbose("load_threaded_cancel(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+		return ERR_INVALID_PARAMETER;
+	}
+
+	LoadToken *load_token = user_load_tokens[p_path];
+	DEV_ASSERT(load_token->user_rc >= 1);
+
+	load_token->user_rc--;
+	if (load_token->user_rc == 0) {
+		// Nobody else requested it, so the load itself can be given up.
+		if (load_token->task_if_unregistered) {
+			_load_task_cancel(*load_token->task_if_unregistered);
+		} else if (!load_token->local_path.is_empty()) {
+			_load_task_cancel(thread_load_tasks[load_token->local_path]);
+		}
+
+		load_token->user_path.clear();
+		user_load_tokens.erase(p_path);
+		if (load_token->unreference()) {
+			memdelete(load_token);
+			load_token = nullptr;
+		}
+	}
+
+	print_lt("CANCEL: user load tokens: " + itos(user_load_tokens.size()));
+
+	return OK;
+}
+
+// Must be called with the thread load mutex locked.
+void ResourceLoader::_load_task_cancel(ThreadLoadTask &p_load_task) {
+	if (p_load_task.status != THREAD_LOAD_IN_PROGRESS || p_load_task.cancelled) {
+		return;
+	}
+	p_load_task.cancelled = true;
+
+	for (const String &dependency_path : p_load_task.dependency_tasks) {
+		HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(dependency_path);
+		if (!E || (E->value.load_token && E->value.load_token->user_rc)) {
+			continue; // Gone, or requested by the user on its own.
+		}
+
+		// Keep it if any other live load depends on it as well.
+		bool shared = false;
+		for (const KeyValue<String, ThreadLoadTask> &F : thread_load_tasks) {
+			if (&F.value != &p_load_task && !F.value.cancelled && F.value.status == THREAD_LOAD_IN_PROGRESS && F.value.dependency_tasks.has(dependency_path)) {
+				shared = true;
+				break;
+			}
+		}
+		if (!shared) {
+			_load_task_cancel(E->value);
+		}
+	}
+}
+
 Ref<Resource> ResourceLoader::_load_complete(LoadToken &p_load_token, Error *r_error) {
 	MutexLock thread_load_lock(thread_load_mutex);
 	return _load_complete_inner(p_load_token, r_error, thread_load_lock);
@@ -883,7 +971,7 @@ bool ResourceLoader::_ensure_load_progress() {
 	// Some servers may need a new engine iteration to allow the load to progress.
 	// Since the only known one is the rendering server (in single thread mode), let's keep it simple and just sync it.
 	// This may be refactored in the future to support other servers and have less coupling.
-	if (OS::get_singleton()->is_separate_thread_rendering_enabled()) {
+	if (OS::get_singleton()->is_separate_thread_rendering_enabled() || !RenderingServer::get_singleton()) {
 		return false; // Not needed.
 	}
 	RenderingServer::get_singleton()->sync();
@@ -122,6 +122,11 @@ public:
 		LOAD_THREAD_DISTRIBUTE,
 	};
 
+	enum LoadPriority {
+		LOAD_PRIORITY_NORMAL,
+		LOAD_PRIORITY_HIGH,
+	};
+
 	struct LoadToken : public RefCounted {
 		String local_path;
 		String user_path;
@@ -135,7 +140,7 @@ public:
 
 	static const int BINARY_MUTEX_TAG = 1;
 
-	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user = false);
+	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user = false, LoadPriority p_priority = LOAD_PRIORITY_NORMAL);
 	static Ref<Resource> _load_complete(LoadToken &p_load_token, Error *r_error);
 
 private:
@@ -188,7 +193,10 @@ private:
 		Error error = OK;
 		Ref<Resource> resource;
 		bool use_sub_threads = false;
+		LoadPriority priority = LOAD_PRIORITY_NORMAL;
+		bool cancelled = false; // Checked right before the actual load starts.
 		HashSet<String> sub_tasks;
+		HashSet<String> dependency_tasks; // Local paths of the loads started from this one, for cancellation.
 
 		struct ResourceChangedConnection {
 			Resource *source = nullptr;
@@ -214,13 +222,15 @@ private:
 	static HashMap<String, LoadToken *> user_load_tokens;
 
 	static float _dependency_get_progress(const String &p_path);
+	static void _load_task_cancel(ThreadLoadTask &p_load_task);
 
 	static bool _ensure_load_progress();
 
 public:
-	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
+	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE, LoadPriority p_priority = LOAD_PRIORITY_NORMAL);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static Error load_threaded_cancel(const String &p_path);
 
 	static bool is_within_load() { return load_nesting > 0; }
 
@@ -65,6 +65,7 @@ ClassDB::APIType ClassDB::get_current_api() {
 }
 
 HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
+uint64_t ClassDB::class_list_version = 0;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
 
@@ -1596,55 +1597,119 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 	return false;
 }
 
-bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
-	ERR_FAIL_NULL_V(p_object, false);
+void ClassDB::call_property_setter(Object *p_object, const PropertySetGet &p_setget, const Variant &p_value, bool *r_valid) {
+	if (!p_setget.setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return; //do nothing
+	}
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
+	Callable::CallError ce;
 
-			Callable::CallError ce;
+	if (p_setget.index >= 0) {
+		Variant index = p_setget.index;
+		const Variant *arg[2] = { &index, &p_value };
+		//p_object->call(psg->setter,arg,2,ce);
+		if (p_setget._setptr) {
+			p_setget._setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->callp(p_setget.setter, arg, 2, ce);
+		}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 2, ce);
-				}
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (p_setget._setptr) {
+			p_setget._setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->callp(p_setget.setter, arg, 1, ce);
+		}
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 1, ce);
-				}
-			}
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+}
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+void ClassDB::call_property_getter(Object *p_object, const PropertySetGet &p_setget, Variant &r_value) {
+	if (!p_setget.getter) {
+		return; //do nothing
+	}
 
-			return true;
+	if (p_setget.index >= 0) {
+		Variant index = p_setget.index;
+		const Variant *arg[1] = { &index };
+		Callable::CallError ce;
+		const Variant value = p_object->callp(p_setget.getter, arg, 1, ce);
+		r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
+
+	} else {
+		Callable::CallError ce;
+		if (p_setget._getptr) {
+			r_value = p_setget._getptr->call(p_object, nullptr, 0, ce);
+		} else {
+			const Variant value = p_object->callp(p_setget.getter, nullptr, 0, ce);
+			r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
 		}
+	}
+}
 
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
 		check = check->inherits_ptr;
 	}
+	return nullptr;
+}
+
+uint64_t ClassDB::get_class_list_version() {
+	return class_list_version;
+}
+
+bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
+	ERR_FAIL_NULL_V(p_object, false);
+
+	const PropertySetGet *psg = get_property_setget(p_object->get_class_name(), p_property);
+	if (psg) {
+		call_property_setter(p_object, *psg, p_value, r_valid);
+		return true; //return true even if there is no setter
+	}
 
 	return false;
 }
 
+void ClassDB::set_properties(Object *p_object, const StringName *p_properties, const PropertySetGet *const *p_setgets, const Variant *p_values, uint32_t p_count) {
+	ERR_FAIL_NULL(p_object);
+
+	// Scripts and extensions may override any property, so only call the bound setters directly
+	// when neither can intercept them.
+	const bool direct = !p_object->script_instance && !(p_object->_extension && p_object->_extension->set);
+	for (uint32_t i = 0; i < p_count; i++) {
+		if (direct && p_setgets[i]) {
+			call_property_setter(p_object, *p_setgets[i], p_values[i]);
+		} else {
+			p_object->set(p_properties[i], p_values[i]);
+		}
+	}
+}
+
+void ClassDB::get_properties(Object *p_object, const StringName *p_properties, const PropertySetGet *const *p_setgets, Variant *r_values, uint32_t p_count) {
+	ERR_FAIL_NULL(p_object);
+
+	const bool direct = !p_object->script_instance && !(p_object->_extension && p_object->_extension->get);
+	for (uint32_t i = 0; i < p_count; i++) {
+		if (direct && p_setgets[i]) {
+			call_property_getter(p_object, *p_setgets[i], r_values[i]);
+		} else {
+			r_values[i] = p_object->get(p_properties[i]);
+		}
+	}
+}
+
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
@@ -1653,26 +1718,7 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
 		if (psg) {
-			if (!psg->getter) {
-				return true; //return true but do nothing
-			}
-
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[1] = { &index };
-				Callable::CallError ce;
-				const Variant value = p_object->callp(psg->getter, arg, 1, ce);
-				r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
-
-			} else {
-				Callable::CallError ce;
-				if (psg->_getptr) {
-					r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
-				} else {
-					const Variant value = p_object->callp(psg->getter, nullptr, 0, ce);
-					r_value = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
-				}
-			}
+			call_property_getter(p_object, *psg, r_value);
 			return true;
 		}
 
@@ -2263,6 +2309,7 @@ void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_
 		}
 	}
 	classes.erase(p_class);
+	class_list_version++;
 	default_values_cached.erase(p_class);
 	default_values.erase(p_class);
 #ifdef TOOLS_ENABLED
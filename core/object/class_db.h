@@ -39,6 +39,7 @@
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/swiss_hash_map.h"
 
 #include <type_traits>
 
@@ -105,7 +106,7 @@ public:
 
 		ObjectGDExtension *gdextension = nullptr;
 
-		HashMap<StringName, MethodBind *> method_map;
+		SwissHashMap<StringName, MethodBind *> method_map;
 		HashMap<StringName, LocalVector<MethodBind *>> method_map_compatibility;
 		HashMap<StringName, int64_t> constant_map;
 		struct EnumInfo {
@@ -154,6 +155,7 @@ public:
 
 	static RWLock lock;
 	static HashMap<StringName, ClassInfo> classes;
+	static uint64_t class_list_version;
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -434,6 +436,15 @@ public:
 	static void get_linked_properties_info(const StringName &p_class, const StringName &p_property, List<StringName> *r_properties, bool p_no_inheritance = false);
 	static bool set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid = nullptr);
 	static bool get_property(Object *p_object, const StringName &p_property, Variant &r_value);
+	// Resolve a property once, then access it on any instance of the class without looking it up again.
+	// Pointers stay valid as long as get_class_list_version() does not change.
+	static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
+	static uint64_t get_class_list_version();
+	static void call_property_setter(Object *p_object, const PropertySetGet &p_setget, const Variant &p_value, bool *r_valid = nullptr);
+	static void call_property_getter(Object *p_object, const PropertySetGet &p_setget, Variant &r_value);
+	// Bulk variants of Object::set() and Object::get(), a null setget falls back to the regular path.
+	static void set_properties(Object *p_object, const StringName *p_properties, const PropertySetGet *const *p_setgets, const Variant *p_values, uint32_t p_count);
+	static void get_properties(Object *p_object, const StringName *p_properties, const PropertySetGet *const *p_setgets, Variant *r_values, uint32_t p_count);
 	static bool has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance = false);
 	static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
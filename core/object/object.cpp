@@ -760,6 +760,14 @@ Variant Object::callv(const StringName &p_method, const Array &p_args) {
 	return ret;
 }
 
+Variant Object::call_method_bind(MethodBind *p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+	r_error.error = Callable::CallError::CALL_OK;
+
+	OBJ_DEBUG_LOCK
+
+	return p_method->call(this, p_args, p_argcount, r_error);
+}
+
 Variant Object::callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
 	r_error.error = Callable::CallError::CALL_OK;
 
@@ -1132,6 +1140,47 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+Object::SignalData::Snapshot *Object::SignalData::acquire_snapshot() {
+	snapshot_lock.lock();
+	if (!snapshot) {
+		snapshot = memnew(Snapshot);
+		snapshot->refcount.init();
+		snapshot->callables.reserve(slot_map.size());
+		snapshot->flags.reserve(slot_map.size());
+		for (const KeyValue<Callable, Slot> &slot_kv : slot_map) {
+			snapshot->callables.push_back(slot_kv.value.conn.callable);
+			snapshot->flags.push_back(slot_kv.value.conn.flags);
+		}
+	}
+	snapshot->refcount.ref();
+	Snapshot *result = snapshot;
+	snapshot_lock.unlock();
+	return result;
+}
+
+void Object::SignalData::release_snapshot(Snapshot *p_snapshot) {
+	if (p_snapshot->refcount.unref()) {
+		memdelete(p_snapshot);
+	}
+}
+
+void Object::SignalData::invalidate_snapshot() {
+	Snapshot *old_snapshot = nullptr;
+	snapshot_lock.lock();
+	SWAP(old_snapshot, snapshot);
+	snapshot_lock.unlock();
+	if (old_snapshot) {
+		release_snapshot(old_snapshot);
+	}
+}
+
+void Object::SignalData::operator=(const SignalData &p_other) {
+	invalidate_snapshot();
+	user = p_other.user;
+	slot_map = p_other.slot_map;
+	removable = p_other.removable;
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
@@ -1154,17 +1203,10 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	// Ensure that disconnecting the signal or even deleting the object
 	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
-	}
-
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	SignalData::Snapshot *snapshot = s->acquire_snapshot();
+	const Callable *slot_callables = snapshot->callables.ptr();
+	const uint32_t *slot_flags = snapshot->flags.ptr();
+	const uint32_t slot_count = snapshot->callables.size();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
 	for (uint32_t i = 0; i < slot_count; ++i) {
@@ -1222,9 +1264,7 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
+	SignalData::release_snapshot(snapshot);
 
 	return err;
 }
@@ -1439,6 +1479,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->invalidate_snapshot();
 
 	return OK;
 }
@@ -1514,6 +1555,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->invalidate_snapshot();
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2192,15 +2234,16 @@ void postinitialize_handler(Object *p_object) {
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func) {
-	spin_lock.lock();
+	_lock_all();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+	for (uint32_t i = 0, count = slot_count.load(std::memory_order_relaxed), max = slot_max.load(std::memory_order_relaxed); i < max && count != 0; i++) {
+		const ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.validator.load(std::memory_order_relaxed)) {
+			p_func(object_slot.object.load(std::memory_order_relaxed));
 			count--;
 		}
 	}
-	spin_lock.unlock();
+	_unlock_all();
 }
 
 #ifdef TOOLS_ENABLED
@@ -2250,45 +2293,84 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 #endif
 
 SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+std::atomic<uint32_t> ObjectDB::slot_count = 0;
+std::atomic<uint32_t> ObjectDB::slot_max = 0;
+ObjectDB::ObjectSlot *ObjectDB::object_slot_chunks[OBJECTDB_SLOT_CHUNK_COUNT] = {};
+LocalVector<uint32_t> ObjectDB::free_slots;
+ObjectDB::ThreadCache ObjectDB::thread_caches[THREAD_CACHE_SLOTS];
+std::atomic<uint64_t> ObjectDB::validator_counter = 0;
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	return slot_count.load(std::memory_order_relaxed);
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
-	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+// Must be called with the shared lock held.
+uint32_t ObjectDB::_pop_free_slot() {
+	if (free_slots.size()) {
+		uint32_t slot = free_slots[free_slots.size() - 1];
+		free_slots.resize(free_slots.size() - 1);
+		return slot;
+	}
+
+	uint32_t slot = slot_max.load(std::memory_order_relaxed);
+	CRASH_COND(slot == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	if ((slot & OBJECTDB_SLOT_CHUNK_MASK) == 0) {
+		ObjectSlot *chunk = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * (OBJECTDB_SLOT_CHUNK_MASK + 1));
+		for (uint32_t i = 0; i <= OBJECTDB_SLOT_CHUNK_MASK; i++) {
+			memnew_placement(&chunk[i], ObjectSlot);
 		}
-		slot_max = new_slot_max;
+		object_slot_chunks[slot >> OBJECTDB_SLOT_CHUNK_BITS] = chunk;
 	}
+	// Publishes the chunk to lookups.
+	slot_max.store(slot + 1, std::memory_order_release);
+	return slot;
+}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+void ObjectDB::_lock_all() {
+	for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+		thread_caches[i].lock.lock();
+	}
+	spin_lock.lock();
+}
+
+void ObjectDB::_unlock_all() {
+	spin_lock.unlock();
+	for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+		thread_caches[i].lock.unlock();
+	}
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	ThreadCache &cache = thread_caches[Thread::get_caller_id() % THREAD_CACHE_SLOTS];
+	cache.lock.lock();
+	if (unlikely(cache.count == 0)) {
+		spin_lock.lock();
+		while (cache.count < THREAD_CACHE_BATCH) {
+			cache.slots[cache.count++] = _pop_free_slot();
+		}
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+	uint32_t slot = cache.slots[--cache.count];
+
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (unlikely(object_slot.object.load(std::memory_order_relaxed) != nullptr)) {
+		cache.lock.unlock();
+		ERR_FAIL_V(ObjectID());
 	}
-	object_slots[slot].validator = validator_counter;
 
-	uint64_t id = validator_counter;
+	uint64_t validator = (validator_counter.fetch_add(1, std::memory_order_relaxed) + 1) & OBJECTDB_VALIDATOR_MASK;
+	if (unlikely(validator == 0)) {
+		validator = (validator_counter.fetch_add(1, std::memory_order_relaxed) + 1) & OBJECTDB_VALIDATOR_MASK;
+	}
+
+	// Lookups are lock-free, and rely on the validator being stored last.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.validator.store(validator | (p_object->is_ref_counted() ? SLOT_REF_COUNTED_BIT : 0), std::memory_order_release);
+	slot_count.fetch_add(1, std::memory_order_relaxed);
+	cache.lock.unlock();
+
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2296,10 +2378,6 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
-
-	spin_lock.unlock();
-
 	return ObjectID(id);
 }
 
@@ -2307,33 +2385,37 @@ void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
 
-	spin_lock.lock();
+	ObjectSlot &object_slot = _get_slot(slot);
 
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
-	}
+	ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+		ERR_FAIL_COND((object_slot.validator.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator);
 	}
 
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	ThreadCache &cache = thread_caches[Thread::get_caller_id() % THREAD_CACHE_SLOTS];
+	cache.lock.lock();
 
-	spin_lock.unlock();
+	//invalidate first, so lookups racing with the removal fail
+	object_slot.validator.store(0, std::memory_order_release);
+	object_slot.object.store(nullptr, std::memory_order_release);
+	slot_count.fetch_sub(1, std::memory_order_relaxed);
+
+	if (unlikely(cache.count == THREAD_CACHE_BATCH * 2)) {
+		// Give back the least recently freed half.
+		spin_lock.lock();
+		for (uint32_t i = 0; i < THREAD_CACHE_BATCH; i++) {
+			free_slots.push_back(cache.slots[i]);
+		}
+		spin_lock.unlock();
+		memmove(cache.slots, cache.slots + THREAD_CACHE_BATCH, sizeof(uint32_t) * THREAD_CACHE_BATCH);
+		cache.count = THREAD_CACHE_BATCH;
+	}
+	cache.slots[cache.count++] = slot;
+	cache.lock.unlock();
 }
 
 void ObjectDB::setup() {
@@ -2341,9 +2423,9 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
-	spin_lock.lock();
+	_lock_all();
 
-	if (slot_count > 0) {
+	if (slot_count.load(std::memory_order_relaxed) > 0) {
 		WARN_PRINT("ObjectDB instances leaked at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
@@ -2353,9 +2435,11 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = slot_count.load(std::memory_order_relaxed), max = slot_max.load(std::memory_order_relaxed); i < max && count != 0; i++) {
+				const ObjectSlot &object_slot = _get_slot(i);
+				const uint64_t slot_validator = object_slot.validator.load(std::memory_order_relaxed);
+				if (slot_validator) {
+					Object *obj = object_slot.object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2365,7 +2449,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | ((slot_validator & OBJECTDB_VALIDATOR_MASK) << OBJECTDB_SLOT_MAX_COUNT_BITS) | ((slot_validator & SLOT_REF_COUNTED_BIT) ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2376,9 +2460,17 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < OBJECTDB_SLOT_CHUNK_COUNT; i++) {
+		if (object_slot_chunks[i]) {
+			memfree(object_slot_chunks[i]);
+			object_slot_chunks[i] = nullptr;
+		}
+	}
+	slot_max.store(0, std::memory_order_relaxed);
+	free_slots.reset();
+	for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+		thread_caches[i].count = 0;
 	}
 
-	spin_lock.unlock();
+	_unlock_all();
 }
@@ -39,8 +39,10 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/swiss_hash_map.h"
 #include "core/variant/callable_bind.h"
 #include "core/variant/variant.h"
 
@@ -610,12 +612,35 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Callables and flags of all slots, copied once after the connections change and
+		// shared by every emission until then. Emitters hold a reference while calling,
+		// so connecting, disconnecting or freeing the object mid-emission is safe.
+		struct Snapshot {
+			SafeRefCount refcount;
+			LocalVector<Callable> callables;
+			LocalVector<uint32_t> flags;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		Snapshot *snapshot = nullptr;
+		// Guards the lazy creation and replacement of the snapshot, since the same signal may be
+		// emitted from several threads. Only held for a pointer swap or a rebuild.
+		SpinLock snapshot_lock;
 		bool removable = false;
+
+		Snapshot *acquire_snapshot();
+		static void release_snapshot(Snapshot *p_snapshot);
+		void invalidate_snapshot();
+
+		SignalData() {}
+		SignalData(const SignalData &p_other) :
+				user(p_other.user), slot_map(p_other.slot_map), removable(p_other.removable) {}
+		void operator=(const SignalData &p_other);
+		~SignalData() { invalidate_snapshot(); }
 	};
 
-	HashMap<StringName, SignalData> signal_map;
+	SwissHashMap<StringName, SignalData> signal_map;
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
@@ -861,6 +886,8 @@ public:
 	void get_method_list(List<MethodInfo> *p_list) const;
 	Variant callv(const StringName &p_method, const Array &p_args);
 	virtual Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	// Calls a method previously resolved with ClassDB::get_method(), bypassing the script instance.
+	Variant call_method_bind(MethodBind *p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	virtual Variant call_const(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
 	template <typename... VarArgs>
@@ -1008,18 +1035,50 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+#define OBJECTDB_SLOT_CHUNK_BITS 12
+#define OBJECTDB_SLOT_CHUNK_MASK ((uint32_t(1) << OBJECTDB_SLOT_CHUNK_BITS) - 1)
+#define OBJECTDB_SLOT_CHUNK_COUNT (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_CHUNK_BITS))
+
+	// Slots live in fixed size chunks which are never moved or freed while running,
+	// so get_instance() can read them without locking. Writers publish the object
+	// before the validator and clear the validator first, and readers discard the
+	// object if the validator changed while reading it.
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		std::atomic<uint64_t> validator = 0; // Validator, plus the reference bit at the top.
+		std::atomic<Object *> object = nullptr;
+	};
+
+	static constexpr uint64_t SLOT_REF_COUNTED_BIT = uint64_t(1) << 63;
+
+	// Free slots are cached per thread slot and move to and from the shared free
+	// list in batches, so most instances are added and removed without taking the
+	// shared lock. Cache locks are always acquired before the shared one.
+	// Slots are published and cleared under the cache lock as well, so walking
+	// them with every lock held never sees an instance being added or removed.
+	static constexpr uint32_t THREAD_CACHE_SLOTS = 8;
+	static constexpr uint32_t THREAD_CACHE_BATCH = 16;
+
+	struct ThreadCache {
+		SpinLock lock;
+		uint32_t count = 0;
+		uint32_t slots[THREAD_CACHE_BATCH * 2] = {};
 	};
 
 	static SpinLock spin_lock;
-	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	static std::atomic<uint32_t> slot_count;
+	static std::atomic<uint32_t> slot_max;
+	static ObjectSlot *object_slot_chunks[OBJECTDB_SLOT_CHUNK_COUNT];
+	static LocalVector<uint32_t> free_slots;
+	static ThreadCache thread_caches[THREAD_CACHE_SLOTS];
+	static std::atomic<uint64_t> validator_counter;
+
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return object_slot_chunks[p_slot >> OBJECTDB_SLOT_CHUNK_BITS][p_slot & OBJECTDB_SLOT_CHUNK_MASK];
+	}
+
+	static uint32_t _pop_free_slot();
+	static void _lock_all();
+	static void _unlock_all();
 
 	friend class Object;
 	friend void unregister_core_types();
@@ -1038,20 +1097,21 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ERR_FAIL_COND_V(slot >= slot_max.load(std::memory_order_acquire), nullptr); // This should never happen unless RID is corrupted.
 
+		const ObjectSlot &object_slot = _get_slot(slot);
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely((object_slot.validator.load(std::memory_order_acquire) & OBJECTDB_VALIDATOR_MASK) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed, and even reused, while reading it.
+		if (unlikely((object_slot.validator.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*  property_accessor.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "property_accessor.h"
+
+void PropertyAccessor::_resolve() const {
+	setgets.resize(properties.size());
+	for (int i = 0; i < properties.size(); i++) {
+		setgets[i] = ClassDB::get_property_setget(target_class, properties[i]);
+	}
+	class_list_version = ClassDB::get_class_list_version();
+}
+
+bool PropertyAccessor::_check_object(const Object *p_object) const {
+	ERR_FAIL_NULL_V(p_object, false);
+	ERR_FAIL_COND_V_MSG(!p_object->is_class(target_class), false, vformat("Object of type '%s' can't be accessed by a PropertyAccessor for '%s'.", p_object->get_class(), target_class));
+	if (unlikely(class_list_version != ClassDB::get_class_list_version())) {
+		_resolve();
+	}
+	return true;
+}
+
+Ref<PropertyAccessor> PropertyAccessor::create(const StringName &p_class, const TypedArray<StringName> &p_properties) {
+	ERR_FAIL_COND_V_MSG(!ClassDB::class_exists(p_class), Ref<PropertyAccessor>(), vformat("Class '%s' does not exist.", p_class));
+
+	Vector<StringName> names;
+	names.resize(p_properties.size());
+	for (int i = 0; i < p_properties.size(); i++) {
+		names.write[i] = p_properties[i];
+	}
+
+	Ref<PropertyAccessor> accessor;
+	accessor.instantiate();
+	accessor->setup(p_class, names);
+	return accessor;
+}
+
+void PropertyAccessor::setup(const StringName &p_class, const Vector<StringName> &p_properties) {
+	target_class = p_class;
+	properties = p_properties;
+	_resolve();
+}
+
+TypedArray<StringName> PropertyAccessor::get_properties() const {
+	TypedArray<StringName> ret;
+	ret.resize(properties.size());
+	for (int i = 0; i < properties.size(); i++) {
+		ret[i] = properties[i];
+	}
+	return ret;
+}
+
+void PropertyAccessor::get_values_ptr(Object *p_object, Variant *r_values) const {
+	if (_check_object(p_object)) {
+		ClassDB::get_properties(p_object, properties.ptr(), setgets.ptr(), r_values, properties.size());
+	}
+}
+
+void PropertyAccessor::set_values_ptr(Object *p_object, const Variant *p_values) const {
+	if (_check_object(p_object)) {
+		ClassDB::set_properties(p_object, properties.ptr(), setgets.ptr(), p_values, properties.size());
+	}
+}
+
+Array PropertyAccessor::get_values(Object *p_object) const {
+	Array ret;
+	ret.resize(properties.size());
+	if (!ret.is_empty()) {
+		// A new array is never read-only, so its iterator points straight into its storage.
+		get_values_ptr(p_object, &*ret.begin());
+	}
+	return ret;
+}
+
+void PropertyAccessor::set_values(Object *p_object, const Array &p_values) const {
+	ERR_FAIL_COND_MSG(p_values.size() != properties.size(), vformat("Expected %d values, got %d.", properties.size(), p_values.size()));
+
+	LocalVector<Variant> values;
+	values.resize(p_values.size());
+	for (uint32_t i = 0; i < values.size(); i++) {
+		values[i] = p_values[i];
+	}
+	set_values_ptr(p_object, values.ptr());
+}
+
+void PropertyAccessor::_bind_methods() {
+	ClassDB::bind_static_method("PropertyAccessor", D_METHOD("create", "class_name", "properties"), &PropertyAccessor::create);
+
+	ClassDB::bind_method(D_METHOD("get_target_class"), &PropertyAccessor::get_target_class);
+	ClassDB::bind_method(D_METHOD("get_properties"), &PropertyAccessor::get_properties);
+	ClassDB::bind_method(D_METHOD("get_property_count"), &PropertyAccessor::get_property_count);
+
+	ClassDB::bind_method(D_METHOD("get_values", "object"), &PropertyAccessor::get_values);
+	ClassDB::bind_method(D_METHOD("set_values", "object", "values"), &PropertyAccessor::set_values);
+}
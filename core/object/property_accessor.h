@@ -0,0 +1,73 @@
+/**************************************************************************/
+/*  property_accessor.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PROPERTY_ACCESSOR_H
+#define PROPERTY_ACCESSOR_H
+
+#include "core/object/class_db.h"
+#include "core/object/ref_counted.h"
+#include "core/variant/typed_array.h"
+
+// Resolves a list of properties of a class once, so they can be read and written in
+// bulk on any instance of that class without looking each one up by name again.
+class PropertyAccessor : public RefCounted {
+	GDCLASS(PropertyAccessor, RefCounted);
+
+	StringName target_class;
+	Vector<StringName> properties;
+
+	mutable LocalVector<const ClassDB::PropertySetGet *> setgets;
+	mutable uint64_t class_list_version = 0;
+
+	void _resolve() const;
+	bool _check_object(const Object *p_object) const;
+
+protected:
+	static void _bind_methods();
+
+public:
+	static Ref<PropertyAccessor> create(const StringName &p_class, const TypedArray<StringName> &p_properties);
+
+	void setup(const StringName &p_class, const Vector<StringName> &p_properties);
+	StringName get_target_class() const { return target_class; }
+	TypedArray<StringName> get_properties() const;
+	int get_property_count() const { return properties.size(); }
+
+	// Buffers must hold get_property_count() values, in the order the properties were given.
+	void get_values_ptr(Object *p_object, Variant *r_values) const;
+	void set_values_ptr(Object *p_object, const Variant *p_values) const;
+
+	Array get_values(Object *p_object) const;
+	void set_values(Object *p_object, const Array &p_values) const;
+
+	PropertyAccessor() {}
+};
+
+#endif // PROPERTY_ACCESSOR_H
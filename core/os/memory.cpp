@@ -32,6 +32,10 @@
 
 #include "core/templates/safe_refcount.h"
 
+#ifdef SMALL_ALLOC_CACHE_ENABLED
+#include "core/os/spin_lock.h"
+#endif
+
 #include <stdlib.h>
 #include <string.h>
 
@@ -62,7 +66,187 @@ SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
 #endif
 
-SafeNumeric<uint64_t> Memory::alloc_count;
+#ifdef SMALL_ALLOC_CACHE_ENABLED
+
+// Allocations with a size header (see DATA_OFFSET) small enough to fit in SMALL_ALLOC_MAX bytes are served
+// from size classes, each SMALL_ALLOC_GRANULARITY bytes apart. Every thread keeps free lists of its own and
+// only exchanges blocks with the shared lists in batches, so most allocations take no lock and don't write
+// to memory shared with other threads. Blocks are carved from chunks which are never returned to the system.
+
+static constexpr size_t SMALL_ALLOC_GRANULARITY = 16;
+static constexpr size_t SMALL_ALLOC_MAX = 512;
+static constexpr uint32_t SMALL_ALLOC_CLASS_COUNT = SMALL_ALLOC_MAX / SMALL_ALLOC_GRANULARITY;
+static constexpr uint32_t SMALL_ALLOC_BATCH = 32;
+static constexpr size_t SMALL_ALLOC_CHUNK_SIZE = 64 * 1024;
+static_assert(SMALL_ALLOC_GRANULARITY % alignof(max_align_t) == 0);
+
+struct SmallAllocBlock {
+	SmallAllocBlock *next;
+};
+
+struct SmallAllocSharedList {
+	SpinLock lock;
+	SmallAllocBlock *first = nullptr;
+};
+
+// Trivial on purpose, so it's usable at any point of the thread's life without an initialization check.
+struct SmallAllocThreadCache {
+	SmallAllocBlock *first[SMALL_ALLOC_CLASS_COUNT];
+	uint32_t count[SMALL_ALLOC_CLASS_COUNT];
+#ifdef DEBUG_ENABLED
+	// Memory usage changes not yet added to Memory::mem_usage.
+	int64_t mem_usage_delta;
+#endif
+};
+
+static SmallAllocSharedList small_alloc_shared[SMALL_ALLOC_CLASS_COUNT];
+static thread_local SmallAllocThreadCache small_alloc_cache;
+
+_FORCE_INLINE_ static bool _small_alloc_fits(size_t p_block_size) {
+	return p_block_size <= SMALL_ALLOC_MAX;
+}
+
+_FORCE_INLINE_ static uint32_t _small_alloc_class(size_t p_block_size) {
+	return (p_block_size - 1) / SMALL_ALLOC_GRANULARITY;
+}
+
+static void _small_alloc_refill(uint32_t p_class) {
+	SmallAllocSharedList &shared = small_alloc_shared[p_class];
+	SmallAllocBlock *first = nullptr;
+	uint32_t count = 0;
+
+	shared.lock.lock();
+	if (shared.first) {
+		first = shared.first;
+		SmallAllocBlock *last = first;
+		count = 1;
+		while (count < SMALL_ALLOC_BATCH && last->next) {
+			last = last->next;
+			count++;
+		}
+		shared.first = last->next;
+		last->next = nullptr;
+	}
+	shared.lock.unlock();
+
+	if (!first) {
+		const size_t block_size = (p_class + 1) * SMALL_ALLOC_GRANULARITY;
+		uint8_t *chunk = (uint8_t *)malloc(SMALL_ALLOC_CHUNK_SIZE);
+		if (!chunk) {
+			return;
+		}
+		count = SMALL_ALLOC_CHUNK_SIZE / block_size;
+		for (uint32_t i = 0; i < count; i++) {
+			SmallAllocBlock *block = (SmallAllocBlock *)(chunk + i * block_size);
+			block->next = first;
+			first = block;
+		}
+	}
+
+	small_alloc_cache.first[p_class] = first;
+	small_alloc_cache.count[p_class] = count;
+}
+
+_FORCE_INLINE_ static void *_small_alloc(size_t p_block_size) {
+	const uint32_t size_class = _small_alloc_class(p_block_size);
+	if (unlikely(!small_alloc_cache.first[size_class])) {
+		_small_alloc_refill(size_class);
+		if (!small_alloc_cache.first[size_class]) {
+			return nullptr;
+		}
+	}
+	SmallAllocBlock *block = small_alloc_cache.first[size_class];
+	small_alloc_cache.first[size_class] = block->next;
+	small_alloc_cache.count[size_class]--;
+	return block;
+}
+
+// Hands p_count blocks from the front of the calling thread's list over to the shared list.
+static void _small_alloc_release(uint32_t p_class, uint32_t p_count) {
+	SmallAllocBlock *first = small_alloc_cache.first[p_class];
+	if (!first || !p_count) {
+		return;
+	}
+	SmallAllocBlock *last = first;
+	for (uint32_t i = 1; i < p_count && last->next; i++) {
+		last = last->next;
+	}
+	small_alloc_cache.first[p_class] = last->next;
+	small_alloc_cache.count[p_class] -= MIN(p_count, small_alloc_cache.count[p_class]);
+
+	SmallAllocSharedList &shared = small_alloc_shared[p_class];
+	shared.lock.lock();
+	last->next = shared.first;
+	shared.first = first;
+	shared.lock.unlock();
+}
+
+_FORCE_INLINE_ static void _small_free(void *p_block, size_t p_block_size) {
+	const uint32_t size_class = _small_alloc_class(p_block_size);
+	SmallAllocBlock *block = (SmallAllocBlock *)p_block;
+	block->next = small_alloc_cache.first[size_class];
+	small_alloc_cache.first[size_class] = block;
+	if (unlikely(++small_alloc_cache.count[size_class] > SMALL_ALLOC_BATCH * 2)) {
+		_small_alloc_release(size_class, SMALL_ALLOC_BATCH);
+	}
+}
+
+#ifdef DEBUG_ENABLED
+// Past this amount, a thread adds its memory usage changes to the shared counters.
+static constexpr int64_t MEM_USAGE_FLUSH_THRESHOLD = 64 * 1024;
+
+static void _flush_mem_usage_delta(SafeNumeric<uint64_t> &r_mem_usage, SafeNumeric<uint64_t> &r_max_usage) {
+	int64_t delta = small_alloc_cache.mem_usage_delta;
+	small_alloc_cache.mem_usage_delta = 0;
+	if (delta > 0) {
+		uint64_t new_mem_usage = r_mem_usage.add(delta);
+		r_max_usage.exchange_if_greater(new_mem_usage);
+	} else if (delta < 0) {
+		r_mem_usage.sub(-delta);
+	}
+}
+
+void Memory::_add_mem_usage(uint64_t p_bytes) {
+	small_alloc_cache.mem_usage_delta += p_bytes;
+	if (small_alloc_cache.mem_usage_delta > MEM_USAGE_FLUSH_THRESHOLD) {
+		_flush_mem_usage_delta(mem_usage, max_usage);
+	}
+}
+
+void Memory::_sub_mem_usage(uint64_t p_bytes) {
+	small_alloc_cache.mem_usage_delta -= p_bytes;
+	if (small_alloc_cache.mem_usage_delta < -MEM_USAGE_FLUSH_THRESHOLD) {
+		_flush_mem_usage_delta(mem_usage, max_usage);
+	}
+}
+#endif // DEBUG_ENABLED
+
+void Memory::release_thread_cache() {
+	for (uint32_t i = 0; i < SMALL_ALLOC_CLASS_COUNT; i++) {
+		_small_alloc_release(i, UINT32_MAX);
+	}
+#ifdef DEBUG_ENABLED
+	_flush_mem_usage_delta(mem_usage, max_usage);
+#endif
+}
+
+#else // SMALL_ALLOC_CACHE_ENABLED
+
+#ifdef DEBUG_ENABLED
+void Memory::_add_mem_usage(uint64_t p_bytes) {
+	uint64_t new_mem_usage = mem_usage.add(p_bytes);
+	max_usage.exchange_if_greater(new_mem_usage);
+}
+
+void Memory::_sub_mem_usage(uint64_t p_bytes) {
+	mem_usage.sub(p_bytes);
+}
+#endif // DEBUG_ENABLED
+
+void Memory::release_thread_cache() {
+}
+
+#endif // SMALL_ALLOC_CACHE_ENABLED
 
 inline bool is_power_of_2(size_t x) {
 	return x && ((x & (x - 1U)) == 0U);
@@ -107,12 +291,15 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
+#ifdef SMALL_ALLOC_CACHE_ENABLED
+	// The size header is needed to find the size class again when freeing.
+	void *mem = (prepad && _small_alloc_fits(p_bytes + DATA_OFFSET)) ? _small_alloc(p_bytes + DATA_OFFSET) : malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+#else
 	void *mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+#endif
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 
-	alloc_count.increment();
-
 	if (prepad) {
 		uint8_t *s8 = (uint8_t *)mem;
 
@@ -120,8 +307,7 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		*s = p_bytes;
 
 #ifdef DEBUG_ENABLED
-		uint64_t new_mem_usage = mem_usage.add(p_bytes);
-		max_usage.exchange_if_greater(new_mem_usage);
+		_add_mem_usage(p_bytes);
 #endif
 		return s8 + DATA_OFFSET;
 	} else {
@@ -148,10 +334,41 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
-			max_usage.exchange_if_greater(new_mem_usage);
+			_add_mem_usage(p_bytes - *s);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			_sub_mem_usage(*s - p_bytes);
+		}
+#endif
+
+#ifdef SMALL_ALLOC_CACHE_ENABLED
+		const size_t prev_block_size = *s + DATA_OFFSET;
+		const size_t block_size = p_bytes + DATA_OFFSET;
+		if (_small_alloc_fits(prev_block_size) || (p_bytes != 0 && _small_alloc_fits(block_size))) {
+			if (p_bytes != 0 && _small_alloc_fits(prev_block_size) && _small_alloc_fits(block_size) && _small_alloc_class(prev_block_size) == _small_alloc_class(block_size)) {
+				// Still fits in the same block.
+				*s = p_bytes;
+				return mem + DATA_OFFSET;
+			}
+
+			uint8_t *new_mem = nullptr;
+			if (p_bytes != 0) {
+				new_mem = (uint8_t *)(_small_alloc_fits(block_size) ? _small_alloc(block_size) : malloc(block_size));
+				ERR_FAIL_NULL_V(new_mem, nullptr);
+				// Copy the header too, it holds the element count of CowData.
+				memcpy(new_mem, mem, MIN(prev_block_size, block_size));
+			}
+
+			if (_small_alloc_fits(prev_block_size)) {
+				_small_free(mem, prev_block_size);
+			} else {
+				free(mem);
+			}
+
+			if (!new_mem) {
+				return nullptr;
+			}
+			*(uint64_t *)(new_mem + SIZE_OFFSET) = p_bytes;
+			return new_mem + DATA_OFFSET;
 		}
 #endif
 
@@ -190,14 +407,21 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	alloc_count.decrement();
-
 	if (prepad) {
 		mem -= DATA_OFFSET;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_ALLOC_CACHE_ENABLED)
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		mem_usage.sub(*s);
+#endif
+#ifdef DEBUG_ENABLED
+		_sub_mem_usage(*s);
+#endif
+
+#ifdef SMALL_ALLOC_CACHE_ENABLED
+		if (_small_alloc_fits(*s + DATA_OFFSET)) {
+			_small_free(mem, *s + DATA_OFFSET);
+			return;
+		}
 #endif
 
 		free(mem);
@@ -211,7 +435,12 @@ uint64_t Memory::get_mem_available() {
 }
 
 uint64_t Memory::get_mem_usage() {
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) && defined(SMALL_ALLOC_CACHE_ENABLED)
+	// Other threads may still hold back their changes, but the calling thread's are always accounted for.
+	_flush_mem_usage_delta(mem_usage, max_usage);
+	// Frees of memory allocated by another thread may have been added before the allocation itself.
+	return MAX(int64_t(mem_usage.get()), 0);
+#elif defined(DEBUG_ENABLED)
 	return mem_usage.get();
 #else
 	return 0;
@@ -42,9 +42,10 @@ class Memory {
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
-#endif
 
-	static SafeNumeric<uint64_t> alloc_count;
+	static void _add_mem_usage(uint64_t p_bytes);
+	static void _sub_mem_usage(uint64_t p_bytes);
+#endif
 
 public:
 	// Alignment:  ↓ max_align_t        ↓ uint64_t          ↓ max_align_t
@@ -86,6 +87,11 @@ public:
 	//  free_aligned_static( data );
 	static void free_aligned_static(void *p_memory);
 
+	// Returns the blocks cached by the calling thread to the shared pool, if built with `small_alloc_cache=yes`,
+	// and adds the thread's pending changes to the memory usage. Must be called before a thread exits, or its
+	// cached blocks can't be reused.
+	static void release_thread_cache();
+
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
@@ -67,6 +67,7 @@ void Thread::callback(ID p_caller_id, const Settings &p_settings, Callback p_cal
 	if (platform_functions.term) {
 		platform_functions.term();
 	}
+	Memory::release_thread_cache();
 }
 
 Thread::ID Thread::start(Thread::Callback p_callback, void *p_user, const Settings &p_settings) {
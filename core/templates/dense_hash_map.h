@@ -0,0 +1,736 @@
+/**************************************************************************/
+/*  dense_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef DENSE_HASH_MAP_H
+#define DENSE_HASH_MAP_H
+
+#include "core/templates/a_hash_map.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * An insertion-ordered hash map which keeps its pairs densely in a few
+ * chunks, indexed by a Robin Hood hashed side table like AHashMap's.
+ *
+ * Unlike HashMap, it doesn't allocate a linked node for every pair, and unlike
+ * AHashMap, erasing preserves the insertion order of the remaining pairs.
+ * The order is kept in a separate array, where an erased pair leaves a hole
+ * which iteration skips. Holes are compacted away once the array is full,
+ * before growing it.
+ *
+ * Chunks double in size as the map grows, and pairs never move once inserted,
+ * so pointers and references to them stay valid until they're erased, like
+ * with HashMap. Inserting invalidates iterators, though.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class DenseHashMap {
+public:
+	// Must be a power of two.
+	static constexpr uint32_t INITIAL_CAPACITY = 8;
+	static constexpr uint32_t EMPTY_HASH = 0;
+	static_assert(EMPTY_HASH == 0, "EMPTY_HASH must always be 0 for the memset() optimization.");
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+	// Chunk c holds FIRST_CHUNK_SIZE << c slots.
+	static constexpr uint32_t FIRST_CHUNK_SHIFT = 2;
+	static constexpr uint32_t FIRST_CHUNK_SIZE = 1 << FIRST_CHUNK_SHIFT;
+
+	struct Slot {
+		MapKeyValue pair; // Only constructed while the slot is used.
+		uint32_t position; // In the order while used, next free slot otherwise.
+	};
+
+	struct OrderEntry {
+		uint32_t slot; // EMPTY_SLOT marks an erased pair.
+		uint32_t hash;
+	};
+
+	Slot **chunks = nullptr;
+	uint32_t chunk_count = 0;
+	uint32_t num_slots = 0; // Slots used at some point, including free ones.
+	uint32_t free_slot = EMPTY_SLOT;
+
+	OrderEntry *order = nullptr;
+	HashMapData *map_data = nullptr;
+
+	// Due to optimization, this is `capacity - 1`. Use + 1 to get normal capacity.
+	uint32_t capacity = INITIAL_CAPACITY - 1;
+	uint32_t num_used = 0; // Entries in the order, including erased ones.
+	uint32_t num_elements = 0;
+
+	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_chunk(uint32_t p_slot) {
+		// Chunk c starts at slot FIRST_CHUNK_SIZE * (2^c - 1).
+		const uint32_t n = (p_slot >> FIRST_CHUNK_SHIFT) + 1;
+#if defined(__GNUC__)
+		return 31 - __builtin_clz(n);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse(&index, n);
+		return index;
+#else
+		uint32_t chunk = 0;
+		for (uint32_t i = n >> 1; i; i >>= 1) {
+			chunk++;
+		}
+		return chunk;
+#endif
+	}
+
+	static _FORCE_INLINE_ Slot &_get_slot(Slot *const *p_chunks, uint32_t p_slot) {
+		const uint32_t chunk = _get_chunk(p_slot);
+		return p_chunks[chunk][p_slot - ((FIRST_CHUNK_SIZE << chunk) - FIRST_CHUNK_SIZE)];
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_slot_capacity(uint32_t p_chunk_count) {
+		return (FIRST_CHUNK_SIZE << p_chunk_count) - FIRST_CHUNK_SIZE;
+	}
+
+	// The order holds up to 3/4 of the side table capacity.
+	static _FORCE_INLINE_ uint32_t _get_element_capacity(uint32_t p_capacity) {
+		return (p_capacity + 1) - ((p_capacity + 1) >> 2);
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_capacity_for(uint32_t p_elements) {
+		return next_power_of_2(MAX(INITIAL_CAPACITY, p_elements + p_elements / 3 + 1)) - 1;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_pos, uint32_t p_hash, uint32_t p_capacity) {
+		const uint32_t original_pos = p_hash & p_capacity;
+		return (p_pos - original_pos + p_capacity + 1) & p_capacity;
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t p_hash, uint32_t &r_slot, uint32_t &r_hash_pos) const {
+		if (unlikely(order == nullptr)) {
+			return false; // Failed lookups, no elements.
+		}
+
+		uint32_t pos = p_hash & capacity;
+		uint32_t distance = 0;
+		while (true) {
+			const HashMapData data = map_data[pos];
+			if (data.hash == EMPTY_HASH) {
+				return false;
+			}
+
+			if (data.hash == p_hash && Comparator::compare(_get_slot(chunks, data.hash_to_key).pair.key, p_key)) {
+				r_slot = data.hash_to_key;
+				r_hash_pos = pos;
+				return true;
+			}
+
+			if (distance > _get_probe_length(pos, data.hash, capacity)) {
+				return false;
+			}
+
+			pos = (pos + 1) & capacity;
+			distance++;
+		}
+	}
+
+	void _insert_hash(uint32_t p_hash, uint32_t p_slot) {
+		HashMapData c_data;
+		c_data.hash = p_hash;
+		c_data.hash_to_key = p_slot;
+
+		uint32_t pos = p_hash & capacity;
+		uint32_t distance = 0;
+		while (true) {
+			if (map_data[pos].hash == EMPTY_HASH) {
+#ifdef DEV_ENABLED
+				if (unlikely(distance > 12)) {
+					WARN_PRINT("Excessive collision count (" +
+							itos(distance) + "), is the right hash function being used?");
+				}
+#endif
+				map_data[pos] = c_data;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			const uint32_t existing_probe_len = _get_probe_length(pos, map_data[pos].hash, capacity);
+			if (existing_probe_len < distance) {
+				SWAP(c_data, map_data[pos]);
+				distance = existing_probe_len;
+			}
+
+			pos = (pos + 1) & capacity;
+			distance++;
+		}
+	}
+
+	void _erase_hash(uint32_t p_hash_pos) {
+		uint32_t pos = p_hash_pos;
+		uint32_t next_pos = (pos + 1) & capacity;
+		while (map_data[next_pos].hash != EMPTY_HASH && _get_probe_length(next_pos, map_data[next_pos].hash, capacity) != 0) {
+			SWAP(map_data[next_pos], map_data[pos]);
+
+			pos = next_pos;
+			next_pos = (next_pos + 1) & capacity;
+		}
+
+		map_data[pos].data = EMPTY_HASH;
+	}
+
+	// Removes the holes from the order. The pairs themselves don't move.
+	void _compact() {
+		if (num_elements == num_used) {
+			return;
+		}
+
+		uint32_t dst = 0;
+		for (uint32_t i = 0; i < num_used; i++) {
+			if (order[i].slot == EMPTY_SLOT) {
+				continue;
+			}
+			if (dst != i) {
+				order[dst] = order[i];
+				_get_slot(chunks, order[dst].slot).position = dst;
+			}
+			dst++;
+		}
+		num_used = dst;
+	}
+
+	// Rebuilds the side table from the stored hashes, keys are not hashed again.
+	void _rehash() {
+		memset(map_data, EMPTY_HASH, sizeof(HashMapData) * (capacity + 1));
+		for (uint32_t i = 0; i < num_used; i++) {
+			if (order[i].slot != EMPTY_SLOT) {
+				_insert_hash(order[i].hash, order[i].slot);
+			}
+		}
+	}
+
+	void _allocate() {
+		const uint32_t real_capacity = capacity + 1;
+
+		map_data = reinterpret_cast<HashMapData *>(Memory::alloc_static(sizeof(HashMapData) * real_capacity));
+		order = reinterpret_cast<OrderEntry *>(Memory::alloc_static(sizeof(OrderEntry) * _get_element_capacity(capacity)));
+
+		memset(map_data, EMPTY_HASH, sizeof(HashMapData) * real_capacity);
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		capacity = p_new_capacity;
+
+		Memory::free_static(map_data);
+		map_data = reinterpret_cast<HashMapData *>(Memory::alloc_static(sizeof(HashMapData) * (capacity + 1)));
+		order = reinterpret_cast<OrderEntry *>(Memory::realloc_static(order, sizeof(OrderEntry) * _get_element_capacity(capacity)));
+
+		_compact();
+		_rehash();
+	}
+
+	uint32_t _allocate_slot() {
+		if (free_slot != EMPTY_SLOT) {
+			const uint32_t slot = free_slot;
+			free_slot = _get_slot(chunks, slot).position;
+			return slot;
+		}
+
+		if (num_slots == _get_slot_capacity(chunk_count)) {
+			// Only the chunk list is reallocated, the existing chunks stay in place.
+			chunks = reinterpret_cast<Slot **>(Memory::realloc_static(chunks, sizeof(Slot *) * (chunk_count + 1)));
+			chunks[chunk_count] = reinterpret_cast<Slot *>(Memory::alloc_static(sizeof(Slot) * (FIRST_CHUNK_SIZE << chunk_count)));
+			chunk_count++;
+		}
+		return num_slots++;
+	}
+
+	// Returns the position of the new pair in the order.
+	uint32_t _insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(order == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate();
+		} else if (unlikely(num_used == _get_element_capacity(capacity))) {
+			if (num_elements <= num_used / 2) {
+				// At least half of the order are holes, reuse them.
+				// The side table points to slots, so it stays valid.
+				_compact();
+			} else {
+				_resize_and_rehash(capacity * 2 + 1);
+			}
+		}
+
+		const uint32_t slot_index = _allocate_slot();
+		Slot &slot = _get_slot(chunks, slot_index);
+		memnew_placement(&slot.pair, MapKeyValue(p_key, p_value));
+		slot.position = num_used;
+		order[num_used].slot = slot_index;
+		order[num_used].hash = p_hash;
+		_insert_hash(p_hash, slot_index);
+
+		num_elements++;
+		return num_used++;
+	}
+
+	uint32_t _get_first_pos() const {
+		uint32_t pos = 0;
+		while (pos < num_used && order[pos].slot == EMPTY_SLOT) {
+			pos++;
+		}
+		return pos;
+	}
+
+	void _init_from(const DenseHashMap &p_other) {
+		capacity = p_other.capacity;
+
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		_allocate();
+
+		for (uint32_t i = 0; i < p_other.num_used; i++) {
+			if (p_other.order[i].slot != EMPTY_SLOT) {
+				const uint32_t slot_index = _allocate_slot();
+				Slot &slot = _get_slot(chunks, slot_index);
+				memnew_placement(&slot.pair, MapKeyValue(_get_slot(p_other.chunks, p_other.order[i].slot).pair));
+				slot.position = num_used;
+				order[num_used].slot = slot_index;
+				order[num_used].hash = p_other.order[i].hash;
+				num_used++;
+			}
+		}
+		num_elements = num_used;
+
+		_rehash();
+	}
+
+	void _destroy_elements() {
+		if constexpr (!(std::is_trivially_destructible_v<TKey> && std::is_trivially_destructible_v<TValue>)) {
+			for (uint32_t i = 0; i < num_used; i++) {
+				if (order[i].slot != EMPTY_SLOT) {
+					_get_slot(chunks, order[i].slot).pair.~MapKeyValue();
+				}
+			}
+		}
+	}
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return _get_element_capacity(capacity); }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (order == nullptr || num_used == 0) {
+			return;
+		}
+
+		_destroy_elements();
+		memset(map_data, EMPTY_HASH, (capacity + 1) * sizeof(HashMapData));
+
+		num_slots = 0;
+		free_slot = EMPTY_SLOT;
+		num_used = 0;
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		bool exists = _lookup_pos(p_key, _hash(p_key), slot, hash_pos);
+		CRASH_COND_MSG(!exists, "DenseHashMap key not found.");
+		return _get_slot(chunks, slot).pair.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		bool exists = _lookup_pos(p_key, _hash(p_key), slot, hash_pos);
+		CRASH_COND_MSG(!exists, "DenseHashMap key not found.");
+		return _get_slot(chunks, slot).pair.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		if (_lookup_pos(p_key, _hash(p_key), slot, hash_pos)) {
+			return &_get_slot(chunks, slot).pair.value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		if (_lookup_pos(p_key, _hash(p_key), slot, hash_pos)) {
+			return &_get_slot(chunks, slot).pair.value;
+		}
+		return nullptr;
+	}
+
+	bool has(const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		return _lookup_pos(p_key, _hash(p_key), slot, hash_pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t slot_index = 0;
+		uint32_t hash_pos = 0;
+		if (!_lookup_pos(p_key, _hash(p_key), slot_index, hash_pos)) {
+			return false;
+		}
+
+		_erase_hash(hash_pos);
+		Slot &slot = _get_slot(chunks, slot_index);
+		order[slot.position].slot = EMPTY_SLOT;
+		slot.pair.~MapKeyValue();
+		slot.position = free_slot;
+		free_slot = slot_index;
+		num_elements--;
+
+		// Holes at the end of the order can be reused right away.
+		while (num_used > 0 && order[num_used - 1].slot == EMPTY_SLOT) {
+			num_used--;
+		}
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		if (p_new_capacity <= get_capacity()) {
+			return;
+		}
+		const uint32_t new_capacity = _get_capacity_for(p_new_capacity);
+		if (order == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	// Sorts the pairs by key, like HashMap::sort(). Only available for Variant keys.
+	// Only the order changes, the pairs stay in place.
+	void sort() {
+		if (num_elements < 2) {
+			return;
+		}
+
+		_compact();
+
+		// Insertion sort, which is fast for the common case where the pairs are
+		// already sorted or nearly sorted.
+		for (uint32_t i = 1; i < num_used; i++) {
+			const OrderEntry inserting = order[i];
+			const TKey &key = _get_slot(chunks, inserting.slot).pair.key;
+			uint32_t j = i;
+			while (j > 0 && _hashmap_variant_less_than(key, _get_slot(chunks, order[j - 1].slot).pair.key)) {
+				order[j] = order[j - 1];
+				j--;
+			}
+			order[j] = inserting;
+		}
+
+		for (uint32_t i = 0; i < num_used; i++) {
+			_get_slot(chunks, order[i].slot).position = i;
+		}
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return _get_slot(chunks, order[pos].slot).pair;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return &_get_slot(chunks, order[pos].slot).pair;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			pos++;
+			while (pos < end && order[pos].slot == EMPTY_SLOT) {
+				pos++;
+			}
+			return *this;
+		}
+
+		// Going back from the first pair gives an invalid iterator.
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			while (pos > 0) {
+				pos--;
+				if (order[pos].slot != EMPTY_SLOT) {
+					return *this;
+				}
+			}
+			pos = end;
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return pos == b.pos && order == b.order; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return pos != b.pos || order != b.order; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return pos < end;
+		}
+
+		_FORCE_INLINE_ ConstIterator(Slot *const *p_chunks, const OrderEntry *p_order, uint32_t p_pos, uint32_t p_end) :
+				chunks(p_chunks), order(p_order), pos(p_pos), end(p_end) {}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		Slot *const *chunks = nullptr;
+		const OrderEntry *order = nullptr;
+		uint32_t pos = 0;
+		uint32_t end = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return _get_slot(chunks, order[pos].slot).pair;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return &_get_slot(chunks, order[pos].slot).pair;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			pos++;
+			while (pos < end && order[pos].slot == EMPTY_SLOT) {
+				pos++;
+			}
+			return *this;
+		}
+
+		// Going back from the first pair gives an invalid iterator.
+		_FORCE_INLINE_ Iterator &operator--() {
+			while (pos > 0) {
+				pos--;
+				if (order[pos].slot != EMPTY_SLOT) {
+					return *this;
+				}
+			}
+			pos = end;
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pos == b.pos && order == b.order; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pos != b.pos || order != b.order; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return pos < end;
+		}
+
+		_FORCE_INLINE_ Iterator(Slot *const *p_chunks, const OrderEntry *p_order, uint32_t p_pos, uint32_t p_end) :
+				chunks(p_chunks), order(p_order), pos(p_pos), end(p_end) {}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(chunks, order, pos, end);
+		}
+
+	private:
+		Slot *const *chunks = nullptr;
+		const OrderEntry *order = nullptr;
+		uint32_t pos = 0;
+		uint32_t end = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(chunks, order, _get_first_pos(), num_used);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(chunks, order, num_used, num_used);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return --end();
+	}
+
+	Iterator find(const TKey &p_key) {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		if (!_lookup_pos(p_key, _hash(p_key), slot, hash_pos)) {
+			return end();
+		}
+		return Iterator(chunks, order, _get_slot(chunks, slot).position, num_used);
+	}
+
+	void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(chunks, order, _get_first_pos(), num_used);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(chunks, order, num_used, num_used);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return --end();
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		if (!_lookup_pos(p_key, _hash(p_key), slot, hash_pos)) {
+			return end();
+		}
+		return ConstIterator(chunks, order, _get_slot(chunks, slot).position, num_used);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		bool exists = _lookup_pos(p_key, _hash(p_key), slot, hash_pos);
+		CRASH_COND(!exists);
+		return _get_slot(chunks, slot).pair.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		const uint32_t hash = _hash(p_key);
+		if (!_lookup_pos(p_key, hash, slot, hash_pos)) {
+			const uint32_t pos = _insert_element(p_key, TValue(), hash);
+			slot = order[pos].slot;
+		}
+		return _get_slot(chunks, slot).pair.value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t slot = 0;
+		uint32_t hash_pos = 0;
+		uint32_t pos = 0;
+		const uint32_t hash = _hash(p_key);
+		if (!_lookup_pos(p_key, hash, slot, hash_pos)) {
+			pos = _insert_element(p_key, p_value, hash);
+		} else {
+			_get_slot(chunks, slot).pair.value = p_value;
+			pos = _get_slot(chunks, slot).position;
+		}
+		return Iterator(chunks, order, pos, num_used);
+	}
+
+	// Inserts an element without checking if it already exists.
+	Iterator insert_new(const TKey &p_key, const TValue &p_value) {
+		DEV_ASSERT(!has(p_key));
+		const uint32_t pos = _insert_element(p_key, p_value, _hash(p_key));
+		return Iterator(chunks, order, pos, num_used);
+	}
+
+	/* Indexed access, in insertion order. */
+
+	// Constant time unless pairs were erased since the last compaction.
+	const KeyValue<TKey, TValue> &get_by_index(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		if (likely(num_used == num_elements)) {
+			return _get_slot(chunks, order[p_index].slot).pair;
+		}
+		ConstIterator it = begin();
+		for (uint32_t i = 0; i < p_index; i++) {
+			++it;
+		}
+		return *it;
+	}
+
+	/* Constructors */
+
+	DenseHashMap(const DenseHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	void operator=(const DenseHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+
+		_init_from(p_other);
+	}
+
+	DenseHashMap(uint32_t p_initial_capacity) {
+		capacity = _get_capacity_for(p_initial_capacity);
+	}
+	DenseHashMap() {}
+
+	DenseHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void reset() {
+		if (order != nullptr) {
+			_destroy_elements();
+			Memory::free_static(order);
+			Memory::free_static(map_data);
+			order = nullptr;
+			map_data = nullptr;
+		}
+		if (chunks != nullptr) {
+			for (uint32_t i = 0; i < chunk_count; i++) {
+				Memory::free_static(chunks[i]);
+			}
+			Memory::free_static(chunks);
+			chunks = nullptr;
+		}
+		chunk_count = 0;
+		num_slots = 0;
+		free_slot = EMPTY_SLOT;
+		capacity = INITIAL_CAPACITY - 1;
+		num_used = 0;
+		num_elements = 0;
+	}
+
+	~DenseHashMap() {
+		reset();
+	}
+};
+
+#endif // DENSE_HASH_MAP_H
@@ -0,0 +1,188 @@
+/**************************************************************************/
+/*  frame_allocator.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_allocator.h"
+
+namespace {
+
+struct FramePage {
+	FramePage *next = nullptr;
+	size_t size = 0;
+
+	_FORCE_INLINE_ uint8_t *get_data() { return (uint8_t *)this + sizeof(FramePage); }
+};
+
+struct FrameArena {
+	FramePage *first = nullptr;
+	FramePage *current = nullptr;
+	size_t offset = 0;
+	uint32_t scope_depth = 0;
+
+	static FramePage *create_page(size_t p_size) {
+		FramePage *page = (FramePage *)Memory::alloc_static(sizeof(FramePage) + p_size);
+		page->next = nullptr;
+		page->size = p_size;
+		return page;
+	}
+
+	// Releases everything allocated after `p_page` + `p_offset`.
+	void rewind(FramePage *p_page, size_t p_offset) {
+#ifdef DEBUG_ENABLED
+		for (FramePage *page = p_page; page; page = page->next) {
+			size_t from = page == p_page ? p_offset : 0;
+			size_t to = page == current ? offset : page->size;
+			if (to > from) {
+				memset(page->get_data() + from, FrameAllocator::POISON_BYTE, to - from);
+			}
+			if (page == current) {
+				break;
+			}
+		}
+#endif
+		current = p_page;
+		offset = p_offset;
+	}
+
+	// Called when the outermost scope ends.
+	void reset() {
+		if (!first) {
+			return;
+		}
+		if (current != first) {
+			// The scope did not fit in one page, merge the pages into a
+			// single one sized for it so the next scopes stay contiguous.
+			size_t used = offset;
+			for (FramePage *page = first; page != current; page = page->next) {
+				used += page->size;
+			}
+			clear();
+			used = (used + FrameAllocator::DEFAULT_PAGE_SIZE - 1) & ~(FrameAllocator::DEFAULT_PAGE_SIZE - 1);
+			first = create_page(used);
+			current = first;
+			offset = 0;
+			return;
+		}
+		rewind(first, 0);
+	}
+
+	void clear() {
+		FramePage *page = first;
+		while (page) {
+			FramePage *next = page->next;
+			Memory::free_static(page);
+			page = next;
+		}
+		first = nullptr;
+		current = nullptr;
+		offset = 0;
+	}
+
+	~FrameArena() {
+		clear();
+	}
+};
+
+thread_local FrameArena arena;
+
+} //namespace
+
+void *FrameAllocator::alloc(size_t p_bytes, size_t p_alignment) {
+	DEV_ASSERT(p_alignment > 0 && (p_alignment & (p_alignment - 1)) == 0);
+
+	FrameArena &a = arena;
+	DEV_ASSERT(a.scope_depth > 0);
+
+	while (a.current) {
+		const uintptr_t base = (uintptr_t)a.current->get_data();
+		const uintptr_t aligned = (base + a.offset + p_alignment - 1) & ~(uintptr_t)(p_alignment - 1);
+		const size_t end = aligned - base + p_bytes;
+		if (end <= a.current->size) {
+			a.offset = end;
+			return (void *)aligned;
+		}
+		if (!a.current->next) {
+			break;
+		}
+		a.current = a.current->next;
+		a.offset = 0;
+	}
+
+	FramePage *page = FrameArena::create_page(MAX(DEFAULT_PAGE_SIZE, p_bytes + p_alignment));
+	if (a.current) {
+		a.current->next = page;
+	} else {
+		a.first = page;
+	}
+	a.current = page;
+
+	const uintptr_t base = (uintptr_t)page->get_data();
+	const uintptr_t aligned = (base + p_alignment - 1) & ~(uintptr_t)(p_alignment - 1);
+	a.offset = aligned - base + p_bytes;
+	return (void *)aligned;
+}
+
+size_t FrameAllocator::get_thread_usage() {
+	const FrameArena &a = arena;
+	if (a.scope_depth == 0) {
+		return 0;
+	}
+	size_t usage = a.offset;
+	for (FramePage *page = a.first; page && page != a.current; page = page->next) {
+		usage += page->size;
+	}
+	return usage;
+}
+
+size_t FrameAllocator::get_thread_capacity() {
+	size_t capacity = 0;
+	for (FramePage *page = arena.first; page; page = page->next) {
+		capacity += page->size;
+	}
+	return capacity;
+}
+
+FrameAllocator::Scope::Scope() {
+	FrameArena &a = arena;
+	a.scope_depth++;
+	page = a.current;
+	offset = a.offset;
+}
+
+FrameAllocator::Scope::~Scope() {
+	FrameArena &a = arena;
+	a.scope_depth--;
+	if (a.scope_depth == 0) {
+		a.reset();
+	} else if (page) {
+		a.rewind((FramePage *)page, offset);
+	} else if (a.first) {
+		a.rewind(a.first, 0);
+	}
+}
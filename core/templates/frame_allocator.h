@@ -0,0 +1,159 @@
+/**************************************************************************/
+/*  frame_allocator.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FRAME_ALLOCATOR_H
+#define FRAME_ALLOCATOR_H
+
+#include "core/os/memory.h"
+#include "core/templates/hash_map.h"
+#include "core/typedefs.h"
+
+#include <cstddef>
+#include <type_traits>
+
+// Scoped bump allocator for transient data.
+//
+// Every thread owns an arena of retained pages. Allocating only moves a
+// pointer forward and freeing is a no-op. Allocations must be made inside a
+// `FrameAllocator::Scope`, and everything allocated inside a scope is
+// released when it ends, so the pages are reused by the next scopes without
+// touching the global allocator. Scopes can be nested.
+//
+// In debug builds, released memory is filled with a poison pattern to make
+// use-after-scope bugs visible.
+
+class FrameAllocator {
+public:
+	static constexpr uint8_t POISON_BYTE = 0xCD;
+	static constexpr size_t DEFAULT_PAGE_SIZE = 64 * 1024;
+
+	static void *alloc(size_t p_bytes, size_t p_alignment = alignof(std::max_align_t));
+
+	// Returns uninitialized storage, so only trivial types are accepted.
+	template <typename T>
+	static T *alloc_array(size_t p_count) {
+		static_assert(std::is_trivially_destructible_v<T>, "Frame allocated arrays are never destructed.");
+		return (T *)alloc(sizeof(T) * p_count, alignof(T));
+	}
+
+	// Bytes handed out by the calling thread's arena in its active scopes.
+	static size_t get_thread_usage();
+	// Bytes of page memory retained by the calling thread's arena.
+	static size_t get_thread_capacity();
+
+	class Scope {
+		void *page = nullptr;
+		size_t offset = 0;
+
+	public:
+		Scope();
+		~Scope();
+	};
+};
+
+// Element allocator for containers such as `HashMap`. Destructors are still
+// run, but the storage is only reclaimed when the scope ends, so the
+// container must not outlive the scope either.
+template <typename T>
+class FrameTypedAllocator {
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ T *new_allocation(Args &&...p_args) {
+		return memnew_placement(FrameAllocator::alloc(sizeof(T), alignof(T)), T(p_args...));
+	}
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) {
+		p_allocation->~T();
+	}
+};
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+using FrameHashMap = HashMap<TKey, TValue, Hasher, Comparator, FrameTypedAllocator<HashMapElement<TKey, TValue>>>;
+
+// Minimal `LocalVector` counterpart backed by the frame allocator. Growing
+// leaves the old buffer behind in the arena, which is fine for the short
+// lived lists this is meant for.
+template <typename T>
+class FrameVector {
+	static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "FrameVector only supports trivial types.");
+
+	T *data = nullptr;
+	uint32_t count = 0;
+	uint32_t capacity = 0;
+
+public:
+	_FORCE_INLINE_ T *ptr() { return data; }
+	_FORCE_INLINE_ const T *ptr() const { return data; }
+	_FORCE_INLINE_ uint32_t size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+
+	void reserve(uint32_t p_size) {
+		if (p_size <= capacity) {
+			return;
+		}
+		T *new_data = FrameAllocator::alloc_array<T>(p_size);
+		if (count) {
+			memcpy(new_data, data, sizeof(T) * count);
+		}
+		data = new_data;
+		capacity = p_size;
+	}
+
+	_FORCE_INLINE_ void push_back(const T &p_elem) {
+		if (unlikely(count == capacity)) {
+			reserve(MAX(16u, capacity * 2));
+		}
+		data[count++] = p_elem;
+	}
+
+	void resize(uint32_t p_size) {
+		reserve(p_size);
+		count = p_size;
+	}
+
+	_FORCE_INLINE_ void clear() { count = 0; }
+
+	_FORCE_INLINE_ T &operator[](uint32_t p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+	_FORCE_INLINE_ const T &operator[](uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	_FORCE_INLINE_ T *begin() { return data; }
+	_FORCE_INLINE_ T *end() { return data + count; }
+	_FORCE_INLINE_ const T *begin() const { return data; }
+	_FORCE_INLINE_ const T *end() const { return data + count; }
+};
+
+#endif // FRAME_ALLOCATOR_H
@@ -0,0 +1,280 @@
+/**************************************************************************/
+/*  inline_vector.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef INLINE_VECTOR_H
+#define INLINE_VECTOR_H
+
+#include "core/error/error_macros.h"
+#include "core/os/memory.h"
+#include "core/templates/sort_array.h"
+#include "core/templates/vector.h"
+
+#include <initializer_list>
+#include <type_traits>
+
+// LocalVector counterpart that stores up to INLINE_CAPACITY elements inside
+// the object itself and only allocates once it grows past them. Meant for
+// short-lived lists that are usually small, such as per-call scratch data.
+// Like LocalVector, elements are assumed to be relocatable.
+template <typename T, uint32_t INLINE_CAPACITY, typename U = uint32_t>
+class InlineVector {
+	static_assert(INLINE_CAPACITY > 0);
+
+	U count = 0;
+	U capacity = INLINE_CAPACITY;
+	T *data = (T *)inline_storage;
+	alignas(T) uint8_t inline_storage[sizeof(T) * INLINE_CAPACITY];
+
+	_FORCE_INLINE_ bool _is_inline() const { return data == (const T *)inline_storage; }
+
+	void _grow(U p_capacity) {
+		if (_is_inline()) {
+			T *new_data = (T *)memalloc(p_capacity * sizeof(T));
+			CRASH_COND_MSG(!new_data, "Out of memory");
+			memcpy((void *)new_data, (const void *)data, count * sizeof(T));
+			data = new_data;
+		} else {
+			data = (T *)memrealloc(data, p_capacity * sizeof(T));
+			CRASH_COND_MSG(!data, "Out of memory");
+		}
+		capacity = p_capacity;
+	}
+
+	// Moves the contents of p_from into this vector, which must be empty and inline.
+	void _take(InlineVector &p_from) {
+		if (p_from._is_inline()) {
+			memcpy((void *)data, (const void *)p_from.data, p_from.count * sizeof(T));
+		} else {
+			data = p_from.data;
+			capacity = p_from.capacity;
+			p_from.data = (T *)p_from.inline_storage;
+			p_from.capacity = INLINE_CAPACITY;
+		}
+		count = p_from.count;
+		p_from.count = 0;
+	}
+
+public:
+	_FORCE_INLINE_ T *ptr() { return data; }
+	_FORCE_INLINE_ const T *ptr() const { return data; }
+
+	// Whether the elements still live in the inline storage.
+	_FORCE_INLINE_ bool is_inline() const { return _is_inline(); }
+
+	_FORCE_INLINE_ void push_back(T p_elem) {
+		if (unlikely(count == capacity)) {
+			_grow(capacity << 1);
+		}
+
+		if constexpr (!std::is_trivially_constructible_v<T>) {
+			memnew_placement(&data[count++], T(std::move(p_elem)));
+		} else {
+			data[count++] = std::move(p_elem);
+		}
+	}
+
+	void remove_at(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		count--;
+		for (U i = p_index; i < count; i++) {
+			data[i] = std::move(data[i + 1]);
+		}
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			data[count].~T();
+		}
+	}
+
+	void remove_at_unordered(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		count--;
+		if (count > p_index) {
+			data[p_index] = std::move(data[count]);
+		}
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			data[count].~T();
+		}
+	}
+
+	_FORCE_INLINE_ bool erase(const T &p_val) {
+		int64_t idx = find(p_val);
+		if (idx >= 0) {
+			remove_at(idx);
+			return true;
+		}
+		return false;
+	}
+
+	_FORCE_INLINE_ void clear() { resize(0); }
+	// Also releases the heap storage, if any.
+	void reset() {
+		clear();
+		if (!_is_inline()) {
+			memfree(data);
+			data = (T *)inline_storage;
+			capacity = INLINE_CAPACITY;
+		}
+	}
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ U get_capacity() const { return capacity; }
+	_FORCE_INLINE_ void reserve(U p_size) {
+		if (p_size > capacity) {
+			_grow(nearest_power_of_2_templated(p_size));
+		}
+	}
+
+	_FORCE_INLINE_ U size() const { return count; }
+	void resize(U p_size) {
+		if (p_size < count) {
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				for (U i = p_size; i < count; i++) {
+					data[i].~T();
+				}
+			}
+			count = p_size;
+		} else if (p_size > count) {
+			reserve(p_size);
+			if constexpr (!std::is_trivially_constructible_v<T>) {
+				for (U i = count; i < p_size; i++) {
+					memnew_placement(&data[i], T);
+				}
+			}
+			count = p_size;
+		}
+	}
+
+	_FORCE_INLINE_ const T &operator[](U p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+	_FORCE_INLINE_ T &operator[](U p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	_FORCE_INLINE_ T *begin() { return data; }
+	_FORCE_INLINE_ T *end() { return data + count; }
+	_FORCE_INLINE_ const T *begin() const { return data; }
+	_FORCE_INLINE_ const T *end() const { return data + count; }
+
+	void insert(U p_pos, T p_val) {
+		ERR_FAIL_UNSIGNED_INDEX(p_pos, count + 1);
+		if (p_pos == count) {
+			push_back(std::move(p_val));
+		} else {
+			resize(count + 1);
+			for (U i = count - 1; i > p_pos; i--) {
+				data[i] = std::move(data[i - 1]);
+			}
+			data[p_pos] = std::move(p_val);
+		}
+	}
+
+	int64_t find(const T &p_val, U p_from = 0) const {
+		for (U i = p_from; i < count; i++) {
+			if (data[i] == p_val) {
+				return int64_t(i);
+			}
+		}
+		return -1;
+	}
+
+	bool has(const T &p_val) const {
+		return find(p_val) != -1;
+	}
+
+	template <typename C>
+	void sort_custom() {
+		if (count == 0) {
+			return;
+		}
+		SortArray<T, C> sorter;
+		sorter.sort(data, count);
+	}
+
+	void sort() {
+		sort_custom<_DefaultComparator<T>>();
+	}
+
+	operator Vector<T>() const {
+		Vector<T> ret;
+		ret.resize(count);
+		T *w = ret.ptrw();
+		if (w) {
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				memcpy(w, data, sizeof(T) * count);
+			} else {
+				for (U i = 0; i < count; i++) {
+					w[i] = data[i];
+				}
+			}
+		}
+		return ret;
+	}
+
+	_FORCE_INLINE_ InlineVector() {}
+	_FORCE_INLINE_ InlineVector(std::initializer_list<T> p_init) {
+		reserve(p_init.size());
+		for (const T &element : p_init) {
+			push_back(element);
+		}
+	}
+	InlineVector(const InlineVector &p_from) {
+		resize(p_from.size());
+		for (U i = 0; i < p_from.count; i++) {
+			data[i] = p_from.data[i];
+		}
+	}
+	InlineVector(InlineVector &&p_from) {
+		_take(p_from);
+	}
+
+	void operator=(const InlineVector &p_from) {
+		if (unlikely(this == &p_from)) {
+			return;
+		}
+		resize(p_from.size());
+		for (U i = 0; i < p_from.count; i++) {
+			data[i] = p_from.data[i];
+		}
+	}
+	void operator=(InlineVector &&p_from) {
+		if (unlikely(this == &p_from)) {
+			return;
+		}
+		reset();
+		_take(p_from);
+	}
+
+	~InlineVector() {
+		reset();
+	}
+};
+
+#endif // INLINE_VECTOR_H
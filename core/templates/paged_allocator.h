@@ -52,12 +52,21 @@ class PagedAllocator {
 	uint32_t page_size = 0;
 	SpinLock spin_lock;
 
-public:
-	template <typename... Args>
-	T *alloc(Args &&...p_args) {
-		if constexpr (thread_safe) {
-			spin_lock.lock();
-		}
+	// In thread-safe mode, free elements are cached per thread slot and move
+	// to and from the shared pool in batches, so most allocations and frees
+	// only take an uncontended slot lock. Slot locks are always acquired
+	// before the shared one.
+	static constexpr uint32_t THREAD_CACHE_SLOTS = 8;
+	static constexpr uint32_t THREAD_CACHE_BATCH = 16;
+
+	struct ThreadCache {
+		SpinLock lock;
+		uint32_t count = 0;
+		T *elements[THREAD_CACHE_BATCH * 2];
+	};
+	ThreadCache *thread_caches = nullptr;
+
+	_FORCE_INLINE_ T *_pop() {
 		if (unlikely(allocs_available == 0)) {
 			uint32_t pages_used = pages_allocated;
 
@@ -75,23 +84,84 @@ public:
 		}
 
 		allocs_available--;
-		T *alloc = available_pool[allocs_available >> page_shift][allocs_available & page_mask];
+		return available_pool[allocs_available >> page_shift][allocs_available & page_mask];
+	}
+
+	_FORCE_INLINE_ void _push(T *p_mem) {
+		available_pool[allocs_available >> page_shift][allocs_available & page_mask] = p_mem;
+		allocs_available++;
+	}
+
+	// Must be called with all the locks held.
+	void _flush_thread_caches() {
+		for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+			ThreadCache &cache = thread_caches[i];
+			while (cache.count) {
+				_push(cache.elements[--cache.count]);
+			}
+		}
+	}
+
+	void _lock_all() const {
+		if constexpr (thread_safe) {
+			for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+				thread_caches[i].lock.lock();
+			}
+			spin_lock.lock();
+		}
+	}
+
+	void _unlock_all() const {
 		if constexpr (thread_safe) {
 			spin_lock.unlock();
+			for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+				thread_caches[i].lock.unlock();
+			}
+		}
+	}
+
+public:
+	template <typename... Args>
+	T *alloc(Args &&...p_args) {
+		T *alloc;
+		if constexpr (thread_safe) {
+			ThreadCache &cache = thread_caches[Thread::get_caller_id() % THREAD_CACHE_SLOTS];
+			cache.lock.lock();
+			if (unlikely(cache.count == 0)) {
+				spin_lock.lock();
+				while (cache.count < THREAD_CACHE_BATCH) {
+					cache.elements[cache.count++] = _pop();
+				}
+				spin_lock.unlock();
+			}
+			alloc = cache.elements[--cache.count];
+			cache.lock.unlock();
+		} else {
+			alloc = _pop();
 		}
 		memnew_placement(alloc, T(p_args...));
 		return alloc;
 	}
 
 	void free(T *p_mem) {
-		if constexpr (thread_safe) {
-			spin_lock.lock();
-		}
 		p_mem->~T();
-		available_pool[allocs_available >> page_shift][allocs_available & page_mask] = p_mem;
-		allocs_available++;
 		if constexpr (thread_safe) {
-			spin_lock.unlock();
+			ThreadCache &cache = thread_caches[Thread::get_caller_id() % THREAD_CACHE_SLOTS];
+			cache.lock.lock();
+			if (unlikely(cache.count == THREAD_CACHE_BATCH * 2)) {
+				// Give back the least recently freed half.
+				spin_lock.lock();
+				for (uint32_t i = 0; i < THREAD_CACHE_BATCH; i++) {
+					_push(cache.elements[i]);
+				}
+				spin_lock.unlock();
+				memmove(cache.elements, cache.elements + THREAD_CACHE_BATCH, sizeof(T *) * THREAD_CACHE_BATCH);
+				cache.count = THREAD_CACHE_BATCH;
+			}
+			cache.elements[cache.count++] = p_mem;
+			cache.lock.unlock();
+		} else {
+			_push(p_mem);
 		}
 	}
 
@@ -121,11 +191,12 @@ private:
 public:
 	void reset(bool p_allow_unfreed = false) {
 		if constexpr (thread_safe) {
-			spin_lock.lock();
+			_lock_all();
+			_flush_thread_caches();
 		}
 		_reset(p_allow_unfreed);
 		if constexpr (thread_safe) {
-			spin_lock.unlock();
+			_unlock_all();
 		}
 	}
 
@@ -157,12 +228,16 @@ public:
 	// Power of 2 recommended because of alignment with OS page sizes.
 	// Even if element is bigger, it's still a multiple and gets rounded to amount of pages.
 	PagedAllocator(uint32_t p_page_size = DEFAULT_PAGE_SIZE) {
+		if constexpr (thread_safe) {
+			thread_caches = memnew_arr(ThreadCache, THREAD_CACHE_SLOTS);
+		}
 		configure(p_page_size);
 	}
 
 	~PagedAllocator() {
 		if constexpr (thread_safe) {
-			spin_lock.lock();
+			_lock_all();
+			_flush_thread_caches();
 		}
 		bool leaked = allocs_available < pages_allocated * page_size;
 		if (leaked) {
@@ -173,7 +248,8 @@ public:
 			_reset(false);
 		}
 		if constexpr (thread_safe) {
-			spin_lock.unlock();
+			_unlock_all();
+			memdelete_arr(thread_caches);
 		}
 	}
 };
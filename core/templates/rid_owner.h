@@ -33,6 +33,7 @@
 
 #include "core/os/memory.h"
 #include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
 #include "core/string/print_string.h"
 #include "core/templates/list.h"
 #include "core/templates/rid.h"
@@ -117,21 +118,52 @@ class RID_Alloc : public RID_AllocBase {
 
 	mutable Mutex mutex;
 
-	_FORCE_INLINE_ RID _allocate_rid() {
+	// In thread-safe mode, free indices are cached per thread slot and move
+	// to and from the shared free list in batches, so most allocations and
+	// frees only take an uncontended slot lock instead of the shared mutex.
+	// Slot locks are always acquired before the mutex.
+	static constexpr uint32_t THREAD_CACHE_SLOTS = 8;
+	static constexpr uint32_t THREAD_CACHE_BATCH = 16;
+
+	struct ThreadCache {
+		SpinLock lock;
+		uint32_t count = 0;
+		uint32_t indices[THREAD_CACHE_BATCH * 2];
+	};
+	ThreadCache *thread_caches = nullptr;
+
+	// Allocated RIDs in thread-safe mode, since alloc_count includes the cached indices.
+	SafeNumeric<uint32_t> rid_count;
+
+	_FORCE_INLINE_ ThreadCache &_get_thread_cache() const {
+		return thread_caches[Thread::get_caller_id() % THREAD_CACHE_SLOTS];
+	}
+
+	void _lock_all() const {
 		if constexpr (THREAD_SAFE) {
+			for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+				thread_caches[i].lock.lock();
+			}
 			mutex.lock();
 		}
+	}
 
+	void _unlock_all() const {
+		if constexpr (THREAD_SAFE) {
+			mutex.unlock();
+			for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+				thread_caches[i].lock.unlock();
+			}
+		}
+	}
+
+	// Must be called with the mutex held in thread-safe mode.
+	_FORCE_INLINE_ bool _pop_free_index(uint32_t &r_index) {
 		if (alloc_count == max_alloc) {
 			//allocate a new chunk
 			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
 			if (THREAD_SAFE && chunk_count == chunk_limit) {
-				mutex.unlock();
-				if (description != nullptr) {
-					ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
-				} else {
-					ERR_FAIL_V_MSG(RID(), "Element limit reached.");
-				}
+				return false;
 			}
 
 			//grow chunks
@@ -160,7 +192,46 @@ class RID_Alloc : public RID_AllocBase {
 			}
 		}
 
-		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
+		r_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
+		alloc_count++;
+		return true;
+	}
+
+	// Must be called with the mutex held in thread-safe mode.
+	_FORCE_INLINE_ void _push_free_index(uint32_t p_index) {
+		alloc_count--;
+		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = p_index;
+	}
+
+	_FORCE_INLINE_ RID _allocate_rid() {
+		uint32_t free_index;
+
+		if constexpr (THREAD_SAFE) {
+			ThreadCache &cache = _get_thread_cache();
+			cache.lock.lock();
+			if (unlikely(cache.count == 0)) {
+				mutex.lock();
+				while (cache.count < THREAD_CACHE_BATCH && _pop_free_index(cache.indices[cache.count])) {
+					cache.count++;
+				}
+				mutex.unlock();
+
+				if (unlikely(cache.count == 0)) {
+					cache.lock.unlock();
+					if (description != nullptr) {
+						ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
+					} else {
+						ERR_FAIL_V_MSG(RID(), "Element limit reached.");
+					}
+				}
+			}
+			cache.count--;
+			free_index = cache.indices[cache.count];
+			cache.lock.unlock();
+			rid_count.increment();
+		} else {
+			_pop_free_index(free_index);
+		}
 
 		uint32_t free_chunk = free_index / elements_in_chunk;
 		uint32_t free_element = free_index % elements_in_chunk;
@@ -174,12 +245,6 @@ class RID_Alloc : public RID_AllocBase {
 		chunks[free_chunk][free_element].validator = validator;
 		chunks[free_chunk][free_element].validator |= 0x80000000; //mark uninitialized bit
 
-		alloc_count++;
-
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
-
 		return _make_from_id(id);
 	}
 
@@ -340,69 +405,86 @@ public:
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
+		uint32_t validator = uint32_t(id >> 32);
+
+		if constexpr (THREAD_SAFE) {
+			uint32_t ma = ((std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_relaxed);
+			if (unlikely(idx >= ma)) {
+				ERR_FAIL();
 			}
-			ERR_FAIL();
-		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
+			Chunk &c = chunks[idx / elements_in_chunk][idx % elements_in_chunk];
 
-		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(chunks[idx_chunk][idx_element].validator & 0x80000000)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
+			// Invalidate first, so that racing frees of the same RID can't both succeed.
+			std::atomic<uint32_t> *c_validator = (std::atomic<uint32_t> *)&c.validator;
+			uint32_t current = c_validator->load(std::memory_order_acquire);
+			if (unlikely(current & 0x80000000)) {
+				ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
+			} else if (unlikely(current != validator || !c_validator->compare_exchange_strong(current, 0xFFFFFFFF, std::memory_order_acq_rel))) {
+				ERR_FAIL();
 			}
-			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(chunks[idx_chunk][idx_element].validator != validator)) {
-			if constexpr (THREAD_SAFE) {
+
+			c.data.~T();
+			rid_count.decrement();
+
+			ThreadCache &cache = _get_thread_cache();
+			cache.lock.lock();
+			if (unlikely(cache.count == THREAD_CACHE_BATCH * 2)) {
+				// Give back the least recently freed half.
+				mutex.lock();
+				for (uint32_t i = 0; i < THREAD_CACHE_BATCH; i++) {
+					_push_free_index(cache.indices[i]);
+				}
 				mutex.unlock();
+				memmove(cache.indices, cache.indices + THREAD_CACHE_BATCH, sizeof(uint32_t) * THREAD_CACHE_BATCH);
+				cache.count = THREAD_CACHE_BATCH;
+			}
+			cache.indices[cache.count++] = idx;
+			cache.lock.unlock();
+		} else {
+			if (unlikely(idx >= max_alloc)) {
+				ERR_FAIL();
 			}
-			ERR_FAIL();
-		}
 
-		chunks[idx_chunk][idx_element].data.~T();
-		chunks[idx_chunk][idx_element].validator = 0xFFFFFFFF; // go invalid
+			uint32_t idx_chunk = idx / elements_in_chunk;
+			uint32_t idx_element = idx % elements_in_chunk;
 
-		alloc_count--;
-		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
+			if (unlikely(chunks[idx_chunk][idx_element].validator & 0x80000000)) {
+				ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
+			} else if (unlikely(chunks[idx_chunk][idx_element].validator != validator)) {
+				ERR_FAIL();
+			}
 
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
+			chunks[idx_chunk][idx_element].data.~T();
+			chunks[idx_chunk][idx_element].validator = 0xFFFFFFFF; // go invalid
+
+			_push_free_index(idx);
 		}
 	}
 
 	_FORCE_INLINE_ uint32_t get_rid_count() const {
-		return alloc_count;
-	}
-	void get_owned_list(List<RID> *p_owned) const {
 		if constexpr (THREAD_SAFE) {
-			mutex.lock();
+			return rid_count.get();
+		} else {
+			return alloc_count;
 		}
+	}
+	void get_owned_list(List<RID> *p_owned) const {
+		_lock_all();
 		for (size_t i = 0; i < max_alloc; i++) {
 			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
 		}
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
+		_unlock_all();
 	}
 
 	//used for fast iteration in the elements or RIDs
 	void fill_owned_buffer(RID *p_rid_buffer) const {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
+		_lock_all();
 		uint32_t idx = 0;
 		for (size_t i = 0; i < max_alloc; i++) {
 			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
@@ -412,9 +494,7 @@ public:
 			}
 		}
 
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
+		_unlock_all();
 	}
 
 	void set_description(const char *p_description) {
@@ -427,6 +507,7 @@ public:
 			chunk_limit = (p_maximum_number_of_elements / elements_in_chunk) + 1;
 			chunks = (Chunk **)memalloc(sizeof(Chunk *) * chunk_limit);
 			free_list_chunks = (uint32_t **)memalloc(sizeof(uint32_t *) * chunk_limit);
+			thread_caches = memnew_arr(ThreadCache, THREAD_CACHE_SLOTS);
 			SYNC_RELEASE;
 		}
 	}
@@ -434,6 +515,13 @@ public:
 	~RID_Alloc() {
 		if constexpr (THREAD_SAFE) {
 			SYNC_ACQUIRE;
+
+			for (uint32_t i = 0; i < THREAD_CACHE_SLOTS; i++) {
+				while (thread_caches[i].count) {
+					_push_free_index(thread_caches[i].indices[--thread_caches[i].count]);
+				}
+			}
+			memdelete_arr(thread_caches);
 		}
 
 		if (alloc_count) {
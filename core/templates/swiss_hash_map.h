@@ -0,0 +1,603 @@
+/**************************************************************************/
+/*  swiss_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SWISS_HASH_MAP_H
+#define SWISS_HASH_MAP_H
+
+#include "core/templates/hash_map.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWISS_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * A HashMap variant that finds entries by probing groups of one byte control
+ * tags, in the style of Swiss tables, instead of using Robin Hood hashing.
+ *
+ * Every slot has a control byte which is either empty, deleted, or holds the
+ * low 7 bits of the hash of its key. A lookup compares a whole group of
+ * control bytes at once (16 using SSE2, 8 using a portable 64-bit fallback)
+ * and only dereferences the elements whose tag matches, so misses and
+ * collisions rarely touch element memory.
+ *
+ * Elements are allocated and linked in insertion order exactly like in
+ * HashMap, so pointers to them stay valid, iteration order is the same and
+ * the API matches. It can be used as a drop-in replacement for lookup heavy
+ * maps.
+ */
+
+struct SwissHashMapGroup {
+	static constexpr int8_t CTRL_EMPTY = -128; // 0b10000000
+	static constexpr int8_t CTRL_DELETED = -2; // 0b11111110
+
+#ifdef SWISS_HASH_MAP_SSE2
+	static constexpr uint32_t WIDTH = 16;
+	typedef uint32_t Mask;
+
+	__m128i ctrl;
+
+	_FORCE_INLINE_ explicit SwissHashMapGroup(const int8_t *p_ctrl) {
+		ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+	}
+
+	_FORCE_INLINE_ Mask match(int8_t p_tag) const {
+		return (Mask)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_tag), ctrl));
+	}
+
+	_FORCE_INLINE_ Mask match_empty() const {
+		return (Mask)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(CTRL_EMPTY), ctrl));
+	}
+
+	// Empty and deleted are the only control bytes with the sign bit set.
+	_FORCE_INLINE_ Mask match_empty_or_deleted() const {
+		return (Mask)_mm_movemask_epi8(ctrl);
+	}
+
+	static _FORCE_INLINE_ uint32_t lowest(Mask p_mask) {
+#if defined(__GNUC__)
+		return __builtin_ctz(p_mask);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, p_mask);
+		return index;
+#else
+		uint32_t index = 0;
+		while (!(p_mask & 1)) {
+			p_mask >>= 1;
+			index++;
+		}
+		return index;
+#endif
+	}
+#else
+	// Portable fallback, processes 8 control bytes in a 64-bit word. Each
+	// matching byte sets its most significant bit in the mask.
+	static constexpr uint32_t WIDTH = 8;
+	typedef uint64_t Mask;
+
+	static constexpr uint64_t LSBS = 0x0101010101010101ULL;
+	static constexpr uint64_t MSBS = 0x8080808080808080ULL;
+
+	uint64_t ctrl;
+
+	_FORCE_INLINE_ explicit SwissHashMapGroup(const int8_t *p_ctrl) {
+		memcpy(&ctrl, p_ctrl, sizeof(uint64_t));
+#ifdef BIG_ENDIAN_ENABLED
+		ctrl = BSWAP64(ctrl);
+#endif
+	}
+
+	// May report false positives, which are discarded when comparing keys.
+	_FORCE_INLINE_ Mask match(int8_t p_tag) const {
+		const uint64_t x = ctrl ^ (LSBS * (uint8_t)p_tag);
+		return (x - LSBS) & ~x & MSBS;
+	}
+
+	_FORCE_INLINE_ Mask match_empty() const {
+		return (ctrl & ~(ctrl << 6)) & MSBS;
+	}
+
+	_FORCE_INLINE_ Mask match_empty_or_deleted() const {
+		return ctrl & MSBS;
+	}
+
+	static _FORCE_INLINE_ uint32_t lowest(Mask p_mask) {
+#if defined(__GNUC__)
+		return __builtin_ctzll(p_mask) >> 3;
+#elif defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		_BitScanForward64(&index, p_mask);
+		return index >> 3;
+#else
+		uint32_t index = 0;
+		while (!(p_mask & 0xFF)) {
+			p_mask >>= 8;
+			index++;
+		}
+		return index;
+#endif
+	}
+#endif
+
+	static _FORCE_INLINE_ Mask next(Mask p_mask) {
+		return p_mask & (p_mask - 1);
+	}
+
+	// Maximum amount of elements for a capacity, keeps at least 1/8 of the slots empty.
+	static _FORCE_INLINE_ uint32_t max_load(uint32_t p_capacity) {
+		return p_capacity - p_capacity / 8;
+	}
+};
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>,
+		typename Allocator = DefaultTypedAllocator<HashMapElement<TKey, TValue>>>
+class SwissHashMap {
+	typedef SwissHashMapGroup Group;
+	typedef HashMapElement<TKey, TValue> Element;
+
+	Allocator element_alloc;
+	Element **elements = nullptr;
+	int8_t *ctrl = nullptr;
+	Element *head_element = nullptr;
+	Element *tail_element = nullptr;
+
+	// Always a power of two and a multiple of the group width.
+	uint32_t capacity = Group::WIDTH;
+	uint32_t num_elements = 0;
+	// Empty slots that can still be used before rehashing.
+	uint32_t growth_left = 0;
+
+	static _FORCE_INLINE_ int8_t _get_tag(uint32_t p_hash) {
+		return (int8_t)(p_hash & 0x7F);
+	}
+
+	static uint32_t _get_capacity_for(uint32_t p_elements) {
+		uint32_t new_capacity = Group::WIDTH;
+		while (Group::max_load(new_capacity) < p_elements) {
+			new_capacity <<= 1;
+		}
+		return new_capacity;
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (elements == nullptr || num_elements == 0) {
+			return false; // Failed lookups, no elements
+		}
+
+		const uint32_t hash = Hasher::hash(p_key);
+		const int8_t tag = _get_tag(hash);
+		const uint32_t group_mask = capacity / Group::WIDTH - 1;
+		uint32_t group_index = (hash >> 7) & group_mask;
+
+		// Triangular probing over groups, visits every group once.
+		for (uint32_t probe = 1;; probe++) {
+			const uint32_t base = group_index * Group::WIDTH;
+			const Group group(ctrl + base);
+			for (typename Group::Mask match = group.match(tag); match; match = Group::next(match)) {
+				const uint32_t pos = base + Group::lowest(match);
+				if (Comparator::compare(elements[pos]->data.key, p_key)) {
+					r_pos = pos;
+					return true;
+				}
+			}
+			if (group.match_empty()) {
+				return false;
+			}
+			group_index = (group_index + probe) & group_mask;
+		}
+	}
+
+	void _insert_with_hash(uint32_t p_hash, Element *p_element) {
+		const uint32_t group_mask = capacity / Group::WIDTH - 1;
+		uint32_t group_index = (p_hash >> 7) & group_mask;
+
+		for (uint32_t probe = 1;; probe++) {
+			const uint32_t base = group_index * Group::WIDTH;
+			const typename Group::Mask available = Group(ctrl + base).match_empty_or_deleted();
+			if (available) {
+				const uint32_t pos = base + Group::lowest(available);
+				if (ctrl[pos] == Group::CTRL_EMPTY) {
+					growth_left--;
+				}
+				ctrl[pos] = _get_tag(p_hash);
+				elements[pos] = p_element;
+				num_elements++;
+				return;
+			}
+			group_index = (group_index + probe) & group_mask;
+		}
+	}
+
+	// Frees the slot of an element, which stays allocated and linked.
+	void _release_pos(uint32_t p_pos) {
+		// If the group still has an empty slot, no probe sequence ever went
+		// past it, so the slot can become empty again instead of deleted.
+		const uint32_t base = p_pos & ~(Group::WIDTH - 1);
+		if (Group(ctrl + base).match_empty()) {
+			ctrl[p_pos] = Group::CTRL_EMPTY;
+			growth_left++;
+		} else {
+			ctrl[p_pos] = Group::CTRL_DELETED;
+		}
+		elements[p_pos] = nullptr;
+		num_elements--;
+	}
+
+	void _allocate(uint32_t p_capacity) {
+		capacity = p_capacity;
+		ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(sizeof(int8_t) * capacity));
+		elements = reinterpret_cast<Element **>(Memory::alloc_static(sizeof(Element *) * capacity));
+		memset(ctrl, (uint8_t)Group::CTRL_EMPTY, capacity);
+		num_elements = 0;
+		growth_left = Group::max_load(capacity);
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		const uint32_t old_capacity = capacity;
+		Element **old_elements = elements;
+		int8_t *old_ctrl = ctrl;
+
+		_allocate(p_new_capacity);
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (old_ctrl[i] < 0) {
+				continue;
+			}
+			_insert_with_hash(Hasher::hash(old_elements[i]->data.key), old_elements[i]);
+		}
+
+		Memory::free_static(old_elements);
+		Memory::free_static(old_ctrl);
+	}
+
+	_FORCE_INLINE_ Element *_insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		if (unlikely(elements == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate(capacity);
+		}
+
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			elements[pos]->data.value = p_value;
+			return elements[pos];
+		}
+
+		if (growth_left == 0) {
+			// Either full, or only deleted slots are left and rehashing in place reclaims them.
+			if (num_elements + 1 > Group::max_load(capacity)) {
+				ERR_FAIL_COND_V_MSG(capacity >= (1u << 31), nullptr, "Hash table maximum capacity reached, aborting insertion.");
+				_resize_and_rehash(capacity << 1);
+			} else {
+				_resize_and_rehash(capacity);
+			}
+		}
+
+		Element *elem = element_alloc.new_allocation(Element(p_key, p_value));
+
+		if (tail_element == nullptr) {
+			head_element = elem;
+			tail_element = elem;
+		} else if (p_front_insert) {
+			head_element->prev = elem;
+			elem->next = head_element;
+			head_element = elem;
+		} else {
+			tail_element->next = elem;
+			elem->prev = tail_element;
+			tail_element = elem;
+		}
+
+		_insert_with_hash(Hasher::hash(p_key), elem);
+		return elem;
+	}
+
+public:
+	typedef typename HashMap<TKey, TValue, Hasher, Comparator, Allocator>::Iterator Iterator;
+	typedef typename HashMap<TKey, TValue, Hasher, Comparator, Allocator>::ConstIterator ConstIterator;
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (elements == nullptr || num_elements == 0) {
+			return;
+		}
+		for (uint32_t i = 0; i < capacity; i++) {
+			if (ctrl[i] < 0) {
+				continue;
+			}
+			element_alloc.delete_allocation(elements[i]);
+			elements[i] = nullptr;
+		}
+		memset(ctrl, (uint8_t)Group::CTRL_EMPTY, capacity);
+
+		tail_element = nullptr;
+		head_element = nullptr;
+		num_elements = 0;
+		growth_left = Group::max_load(capacity);
+	}
+
+	void sort() {
+		if (elements == nullptr || num_elements < 2) {
+			return; // An empty or single element map is already sorted.
+		}
+		// Same insertion sort as HashMap, only the element links change.
+		Element *inserting = head_element->next;
+		while (inserting != nullptr) {
+			Element *after = nullptr;
+			for (Element *current = inserting->prev; current != nullptr; current = current->prev) {
+				if (_hashmap_variant_less_than(inserting->data.key, current->data.key)) {
+					after = current;
+				} else {
+					break;
+				}
+			}
+			Element *next = inserting->next;
+			if (after != nullptr) {
+				inserting->prev->next = next;
+				if (next == nullptr) {
+					tail_element = inserting->prev;
+				} else {
+					next->prev = inserting->prev;
+				}
+				Element *before = after->prev;
+				if (before == nullptr) {
+					head_element = inserting;
+				} else {
+					before->next = inserting;
+				}
+				after->prev = inserting;
+				inserting->prev = before;
+				inserting->next = after;
+			}
+			inserting = next;
+		}
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "SwissHashMap key not found.");
+		return elements[pos]->data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "SwissHashMap key not found.");
+		return elements[pos]->data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return false;
+		}
+
+		Element *element = elements[pos];
+		_release_pos(pos);
+
+		if (head_element == element) {
+			head_element = element->next;
+		}
+		if (tail_element == element) {
+			tail_element = element->prev;
+		}
+		if (element->prev) {
+			element->prev->next = element->next;
+		}
+		if (element->next) {
+			element->next->prev = element->prev;
+		}
+
+		element_alloc.delete_allocation(element);
+		return true;
+	}
+
+	// Replace the key of an entry in-place, without invalidating iterators or changing the entries position during iteration.
+	// p_old_key must exist in the map and p_new_key must not, unless it is equal to p_old_key.
+	bool replace_key(const TKey &p_old_key, const TKey &p_new_key) {
+		if (p_old_key == p_new_key) {
+			return true;
+		}
+		uint32_t pos = 0;
+		ERR_FAIL_COND_V(_lookup_pos(p_new_key, pos), false);
+		ERR_FAIL_COND_V(!_lookup_pos(p_old_key, pos), false);
+
+		Element *element = elements[pos];
+		_release_pos(pos);
+
+		const_cast<TKey &>(element->data.key) = p_new_key;
+		if (growth_left == 0) {
+			_resize_and_rehash(capacity);
+		}
+		_insert_with_hash(Hasher::hash(p_new_key), element);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		const uint32_t new_capacity = _get_capacity_for(p_new_capacity);
+		if (new_capacity <= capacity) {
+			return;
+		}
+		if (elements == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(head_element);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(nullptr);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(tail_element);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(elements[pos]);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(head_element);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(nullptr);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(tail_element);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return ConstIterator(elements[pos]);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return elements[pos]->data.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return _insert(p_key, TValue())->data.value;
+		}
+		return elements[pos]->data.value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		return Iterator(_insert(p_key, p_value, p_front_insert));
+	}
+
+	/* Constructors */
+
+	SwissHashMap(const SwissHashMap &p_other) {
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const SwissHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	SwissHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	SwissHashMap() {}
+
+	SwissHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	~SwissHashMap() {
+		clear();
+
+		if (elements != nullptr) {
+			Memory::free_static(elements);
+			Memory::free_static(ctrl);
+		}
+	}
+};
+
+#endif // SWISS_HASH_MAP_H
@@ -33,6 +33,7 @@
 #include "container_type_validate.h"
 #include "core/math/math_funcs.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hashfuncs.h"
 #include "core/templates/search_array.h"
 #include "core/templates/vector.h"
@@ -287,12 +288,24 @@ void Array::push_back(const Variant &p_value) {
 void Array::append_array(const Array &p_array) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
 
-	Vector<Variant> validated_array = p_array._p->array;
-	for (int i = 0; i < validated_array.size(); ++i) {
-		ERR_FAIL_COND(!_p->typed.validate(validated_array.write[i], "append_array"));
+	if (_p->typed.type == Variant::NIL || _p->typed == p_array._p->typed) {
+		// Elements are already valid, skip validating them one by one.
+		_p->array.append_array(p_array._p->array);
+		return;
 	}
 
-	_p->array.append_array(validated_array);
+	// Validate in place once copied, instead of validating a copy of the whole source first.
+	const Vector<Variant> source = p_array._p->array;
+	const int old_size = _p->array.size();
+	_p->array.resize(old_size + source.size());
+	Variant *dst = _p->array.ptrw() + old_size;
+	for (int i = 0; i < source.size(); ++i) {
+		dst[i] = source[i];
+		if (unlikely(!_p->typed.validate(dst[i], "append_array"))) {
+			_p->array.resize(old_size);
+			ERR_FAIL();
+		}
+	}
 }
 
 Error Array::resize(int p_new_size) {
@@ -511,10 +524,11 @@ Array Array::recursive_duplicate(bool p_deep, int recursion_count) const {
 
 	if (p_deep) {
 		recursion_count++;
-		int element_count = size();
-		new_arr.resize(element_count);
-		for (int i = 0; i < element_count; i++) {
-			new_arr[i] = get(i).recursive_duplicate(true, recursion_count);
+		const Vector<Variant> source = _p->array;
+		new_arr._p->array.resize(source.size());
+		Variant *dst = new_arr._p->array.ptrw();
+		for (int i = 0; i < source.size(); i++) {
+			dst[i] = source[i].recursive_duplicate(true, recursion_count);
 		}
 	} else {
 		new_arr._p->array = _p->array;
@@ -558,50 +572,58 @@ Array Array::slice(int p_begin, int p_end, int p_step, bool p_deep) const {
 	return result;
 }
 
+// The functional methods below iterate over a copy of the underlying vector, which only
+// shares the data, so the callable may modify the array without invalidating the iteration.
+
 Array Array::filter(const Callable &p_callable) const {
 	Array new_arr;
-	new_arr.resize(size());
 	new_arr._p->typed = _p->typed;
+
+	const Vector<Variant> source = _p->array;
+	new_arr._p->array.resize(source.size());
+	Variant *dst = new_arr._p->array.ptrw();
 	int accepted_count = 0;
 
+	CallableBatchCaller caller(p_callable);
 	const Variant *argptrs[1];
-	for (int i = 0; i < size(); i++) {
-		argptrs[0] = &get(i);
+	for (int i = 0; i < source.size(); i++) {
+		argptrs[0] = &source[i];
 
 		Variant result;
 		Callable::CallError ce;
-		p_callable.callp(argptrs, 1, result, ce);
+		caller.callp(argptrs, 1, result, ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
 			ERR_FAIL_V_MSG(Array(), vformat("Error calling method from 'filter': %s.", Variant::get_callable_error_text(p_callable, argptrs, 1, ce)));
 		}
 
 		if (result.operator bool()) {
-			new_arr[accepted_count] = get(i);
+			dst[accepted_count] = source[i];
 			accepted_count++;
 		}
 	}
 
-	new_arr.resize(accepted_count);
+	new_arr._p->array.resize(accepted_count);
 
 	return new_arr;
 }
 
 Array Array::map(const Callable &p_callable) const {
 	Array new_arr;
-	new_arr.resize(size());
 
+	const Vector<Variant> source = _p->array;
+	new_arr._p->array.resize(source.size());
+	Variant *dst = new_arr._p->array.ptrw();
+
+	CallableBatchCaller caller(p_callable);
 	const Variant *argptrs[1];
-	for (int i = 0; i < size(); i++) {
-		argptrs[0] = &get(i);
+	for (int i = 0; i < source.size(); i++) {
+		argptrs[0] = &source[i];
 
-		Variant result;
 		Callable::CallError ce;
-		p_callable.callp(argptrs, 1, result, ce);
+		caller.callp(argptrs, 1, dst[i], ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
 			ERR_FAIL_V_MSG(Array(), vformat("Error calling method from 'map': %s.", Variant::get_callable_error_text(p_callable, argptrs, 1, ce)));
 		}
-
-		new_arr[i] = result;
 	}
 
 	return new_arr;
@@ -615,31 +637,35 @@ Variant Array::reduce(const Callable &p_callable, const Variant &p_accum) const
 		start = 1;
 	}
 
+	const Vector<Variant> source = _p->array;
+	CallableBatchCaller caller(p_callable);
 	const Variant *argptrs[2];
-	for (int i = start; i < size(); i++) {
+	for (int i = start; i < source.size(); i++) {
 		argptrs[0] = &ret;
-		argptrs[1] = &get(i);
+		argptrs[1] = &source[i];
 
 		Variant result;
 		Callable::CallError ce;
-		p_callable.callp(argptrs, 2, result, ce);
+		caller.callp(argptrs, 2, result, ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
 			ERR_FAIL_V_MSG(Variant(), vformat("Error calling method from 'reduce': %s.", Variant::get_callable_error_text(p_callable, argptrs, 2, ce)));
 		}
-		ret = result;
+		ret = std::move(result);
 	}
 
 	return ret;
 }
 
 bool Array::any(const Callable &p_callable) const {
+	const Vector<Variant> source = _p->array;
+	CallableBatchCaller caller(p_callable);
 	const Variant *argptrs[1];
-	for (int i = 0; i < size(); i++) {
-		argptrs[0] = &get(i);
+	for (int i = 0; i < source.size(); i++) {
+		argptrs[0] = &source[i];
 
 		Variant result;
 		Callable::CallError ce;
-		p_callable.callp(argptrs, 1, result, ce);
+		caller.callp(argptrs, 1, result, ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
 			ERR_FAIL_V_MSG(false, vformat("Error calling method from 'any': %s.", Variant::get_callable_error_text(p_callable, argptrs, 1, ce)));
 		}
@@ -655,13 +681,15 @@ bool Array::any(const Callable &p_callable) const {
 }
 
 bool Array::all(const Callable &p_callable) const {
+	const Vector<Variant> source = _p->array;
+	CallableBatchCaller caller(p_callable);
 	const Variant *argptrs[1];
-	for (int i = 0; i < size(); i++) {
-		argptrs[0] = &get(i);
+	for (int i = 0; i < source.size(); i++) {
+		argptrs[0] = &source[i];
 
 		Variant result;
 		Callable::CallError ce;
-		p_callable.callp(argptrs, 1, result, ce);
+		caller.callp(argptrs, 1, result, ce);
 		if (ce.error != Callable::CallError::CALL_OK) {
 			ERR_FAIL_V_MSG(false, vformat("Error calling method from 'all': %s.", Variant::get_callable_error_text(p_callable, argptrs, 1, ce)));
 		}
@@ -688,8 +716,74 @@ struct _ArrayVariantSort {
 	}
 };
 
+// Large arrays are split in runs which are sorted on worker threads and then merged.
+// Comparing with OP_LESS never calls into scripts, unlike sort_custom(), so this is safe.
+struct _ArrayParallelSort {
+	static constexpr int MIN_RUN_SIZE = 16384;
+
+	Variant *data = nullptr;
+	int size = 0;
+	int run_size = 0;
+
+	void sort_run(uint32_t p_index, void *p_userdata) {
+		const int begin = p_index * run_size;
+		SortArray<Variant, _ArrayVariantSort> sorter;
+		sorter.sort(data + begin, MIN(run_size, size - begin));
+	}
+
+	// Variants are relocated bitwise, like CowData does when reallocating.
+	static void merge(const Variant *p_src, Variant *p_dst, int p_begin, int p_middle, int p_end) {
+		_ArrayVariantSort compare;
+		int left = p_begin;
+		int right = p_middle;
+		int out = p_begin;
+		while (left < p_middle && right < p_end) {
+			if (compare(p_src[right], p_src[left])) {
+				memcpy((void *)&p_dst[out++], (const void *)&p_src[right++], sizeof(Variant));
+			} else {
+				memcpy((void *)&p_dst[out++], (const void *)&p_src[left++], sizeof(Variant));
+			}
+		}
+		memcpy((void *)&p_dst[out], (const void *)&p_src[left], sizeof(Variant) * (p_middle - left));
+		out += p_middle - left;
+		memcpy((void *)&p_dst[out], (const void *)&p_src[right], sizeof(Variant) * (p_end - right));
+	}
+
+	void sort() {
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		const int runs = MIN(pool->get_thread_count(), size / MIN_RUN_SIZE);
+		run_size = (size + runs - 1) / runs;
+
+		WorkerThreadPool::GroupID group_task = pool->add_template_group_task(this, &_ArrayParallelSort::sort_run, nullptr, runs, -1, true, SNAME("ArraySort"));
+		pool->wait_for_group_task_completion(group_task);
+
+		Variant *src = data;
+		Variant *dst = (Variant *)memalloc(sizeof(Variant) * size);
+		Variant *buffer = dst;
+		for (int width = run_size; width < size; width *= 2) {
+			for (int begin = 0; begin < size; begin += width * 2) {
+				merge(src, dst, begin, MIN(begin + width, size), MIN(begin + width * 2, size));
+			}
+			SWAP(src, dst);
+		}
+		if (src != data) {
+			memcpy((void *)data, (const void *)src, sizeof(Variant) * size);
+		}
+		memfree(buffer);
+	}
+};
+
 void Array::sort() {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	const int size = _p->array.size();
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (size >= _ArrayParallelSort::MIN_RUN_SIZE * 2 && pool && pool->get_thread_count() > 1 && WorkerThreadPool::get_thread_index() == -1) {
+		_ArrayParallelSort parallel_sort;
+		parallel_sort.data = _p->array.ptrw();
+		parallel_sort.size = size;
+		parallel_sort.sort();
+		return;
+	}
 	_p->array.sort_custom<_ArrayVariantSort>();
 }
 
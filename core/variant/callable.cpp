@@ -30,6 +30,7 @@
 
 #include "callable.h"
 
+#include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
@@ -594,11 +595,36 @@ Signal::Signal(ObjectID p_object, const StringName &p_name) {
 	name = p_name;
 }
 
+CallableBatchCaller::CallableBatchCaller(const Callable &p_callable) :
+		callable(p_callable) {
+	if (p_callable.is_null() || p_callable.is_custom()) {
+		return;
+	}
+	Object *obj = p_callable.get_object();
+	// Script resources resolve their own static methods in callp(), skip them. Script
+	// instances can be attached at any time, so those are checked on every call.
+	if (obj && !Object::cast_to<Script>(obj)) {
+		method_bind = ClassDB::get_method(obj->get_class_name(), p_callable.get_method());
+		object_id = obj->get_instance_id();
+	}
+}
+
+void CallableBatchCaller::callp(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
+	if (method_bind) {
+		Object *obj = ObjectDB::get_instance(object_id);
+		if (likely(obj && !obj->get_script_instance())) {
+			r_return_value = obj->call_method_bind(method_bind, p_arguments, p_argcount, r_call_error);
+			return;
+		}
+	}
+	callable.callp(p_arguments, p_argcount, r_return_value, r_call_error);
+}
+
 bool CallableComparator::operator()(const Variant &p_l, const Variant &p_r) const {
 	const Variant *args[2] = { &p_l, &p_r };
 	Callable::CallError err;
 	Variant res;
-	func.callp(args, 2, res, err);
+	caller.callp(args, 2, res, err);
 	ERR_FAIL_COND_V_MSG(err.error != Callable::CallError::CALL_OK, false,
 			"Error calling compare method: " + Variant::get_callable_error_text(func, args, 2, err));
 	return res;
@@ -37,6 +37,7 @@
 class Object;
 class Variant;
 class CallableCustom;
+class MethodBind;
 
 // This is an abstraction of things that can be called.
 // It is used for signals and other cases where efficient calling of functions
@@ -201,10 +202,27 @@ public:
 	Signal() {}
 };
 
+// Calls the same Callable many times, e.g. once per element of an Array. When it is a plain
+// method bound in ClassDB, the MethodBind is resolved once instead of on every call.
+class CallableBatchCaller {
+	const Callable &callable;
+	ObjectID object_id;
+	MethodBind *method_bind = nullptr;
+
+public:
+	void callp(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const;
+
+	CallableBatchCaller(const Callable &p_callable);
+};
+
 struct CallableComparator {
 	const Callable &func;
+	CallableBatchCaller caller;
 
 	bool operator()(const Variant &p_l, const Variant &p_r) const;
+
+	CallableComparator(const Callable &p_func) :
+			func(p_func), caller(p_func) {}
 };
 
 #endif // CALLABLE_H
@@ -30,7 +30,7 @@
 
 #include "dictionary.h"
 
-#include "core/templates/hash_map.h"
+#include "core/templates/dense_hash_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/container_type_validate.h"
 #include "core/variant/variant.h"
@@ -43,7 +43,7 @@
 struct DictionaryPrivate {
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
+	DenseHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
 	ContainerTypeValidate typed_key;
 	ContainerTypeValidate typed_value;
 	Variant *typed_fallback = nullptr; // Allows a typed dictionary to return dummy values when attempting an invalid access.
@@ -60,27 +60,17 @@ void Dictionary::get_key_list(List<Variant> *p_keys) const {
 }
 
 Variant Dictionary::get_key_at_index(int p_index) const {
-	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-		if (index == p_index) {
-			return E.key;
-		}
-		index++;
+	if (p_index < 0 || p_index >= (int)_p->variant_map.size()) {
+		return Variant();
 	}
-
-	return Variant();
+	return _p->variant_map.get_by_index(p_index).key;
 }
 
 Variant Dictionary::get_value_at_index(int p_index) const {
-	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-		if (index == p_index) {
-			return E.value;
-		}
-		index++;
+	if (p_index < 0 || p_index >= (int)_p->variant_map.size()) {
+		return Variant();
 	}
-
-	return Variant();
+	return _p->variant_map.get_by_index(p_index).value;
 }
 
 // WARNING: This operator does not validate the value type. For scripting/extensions this is
@@ -101,10 +91,12 @@ Variant &Dictionary::operator[](const Variant &p_key) {
 		}
 		return *_p->read_only;
 	} else {
-		if (unlikely(!_p->variant_map.has(key))) {
-			VariantInternal::initialize(&_p->variant_map[key], _p->typed_value.type);
+		Variant *value = _p->variant_map.getptr(key);
+		if (unlikely(!value)) {
+			value = &_p->variant_map[key];
+			VariantInternal::initialize(value, _p->typed_value.type);
 		}
-		return _p->variant_map[key];
+		return *value;
 	}
 }
 
@@ -127,7 +119,7 @@ const Variant *Dictionary::getptr(const Variant &p_key) const {
 	if (unlikely(!_p->typed_key.validate(key, "getptr"))) {
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
+	DenseHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
 	if (!E) {
 		return nullptr;
 	}
@@ -140,7 +132,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 	if (unlikely(!_p->typed_key.validate(key, "getptr"))) {
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(key));
+	DenseHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(key));
 	if (!E) {
 		return nullptr;
 	}
@@ -155,7 +147,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 Variant Dictionary::get_valid(const Variant &p_key) const {
 	Variant key = p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "get_valid"), Variant());
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
+	DenseHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
 
 	if (!E) {
 		return Variant();
@@ -264,7 +256,7 @@ bool Dictionary::recursive_equal(const Dictionary &p_dictionary, int recursion_c
 	}
 	recursion_count++;
 	for (const KeyValue<Variant, Variant> &this_E : _p->variant_map) {
-		HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key));
+		DenseHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key));
 		if (!other_E || !this_E.value.hash_compare(other_E->value, recursion_count, false)) {
 			return false;
 		}
@@ -301,6 +293,15 @@ void Dictionary::sort() {
 
 void Dictionary::merge(const Dictionary &p_dictionary, bool p_overwrite) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Dictionary is in read-only state.");
+	if (_p->typed_key.type == Variant::NIL && _p->typed_value.type == Variant::NIL) {
+		// Nothing to validate, insert without copying every key and value first.
+		for (const KeyValue<Variant, Variant> &E : p_dictionary._p->variant_map) {
+			if (p_overwrite || !_p->variant_map.has(E.key)) {
+				_p->variant_map.insert(E.key, E.value);
+			}
+		}
+		return;
+	}
 	for (const KeyValue<Variant, Variant> &E : p_dictionary._p->variant_map) {
 		Variant key = E.key;
 		Variant value = E.value;
@@ -410,7 +411,7 @@ void Dictionary::assign(const Dictionary &p_dictionary) {
 	}
 
 	int size = p_dictionary._p->variant_map.size();
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map = HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>(size);
+	DenseHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map(size);
 
 	Vector<Variant> key_array;
 	key_array.resize(size);
@@ -543,7 +544,7 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 	}
 	Variant key = *p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "next"), nullptr);
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(key);
+	DenseHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(key);
 
 	if (!E) {
 		return nullptr;
@@ -583,13 +584,13 @@ Dictionary Dictionary::recursive_duplicate(bool p_deep, int recursion_count) con
 
 	if (p_deep) {
 		recursion_count++;
+		n._p->variant_map.reserve(_p->variant_map.size());
 		for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
 			n[E.key.recursive_duplicate(true, recursion_count)] = E.value.recursive_duplicate(true, recursion_count);
 		}
 	} else {
-		for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-			n[E.key] = E.value;
-		}
+		// Keys and values were validated when inserted here.
+		n._p->variant_map = _p->variant_map;
 	}
 
 	return n;
@@ -35,12 +35,7 @@
 #include "core/object/script_language.h"
 #include "core/string/string_buffer.h"
 
-char32_t VariantParser::Stream::get_char() {
-	// is within buffer?
-	if (readahead_pointer < readahead_filled) {
-		return readahead_buffer[readahead_pointer++];
-	}
-
+char32_t VariantParser::Stream::_get_char_slow() {
 	// attempt to readahead
 	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
 	if (readahead_filled) {
@@ -51,7 +46,14 @@ char32_t VariantParser::Stream::get_char() {
 		eof = true;
 		return 0;
 	}
-	return get_char();
+	return readahead_buffer[readahead_pointer++];
+}
+
+void VariantParser::Stream::_reset_readahead() {
+	readahead_pointer = 0;
+	readahead_filled = 0;
+	eof = false;
+	saved = 0;
 }
 
 bool VariantParser::Stream::is_eof() const {
@@ -86,6 +88,39 @@ uint32_t VariantParser::StreamFile::_read_buffer(char32_t *p_buffer, uint32_t p_
 	return num_read;
 }
 
+bool VariantParser::StreamBuffer::is_utf8() const {
+	return true;
+}
+
+bool VariantParser::StreamBuffer::_is_eof() const {
+	return pos >= (uint64_t)data.size();
+}
+
+uint32_t VariantParser::StreamBuffer::_read_buffer(char32_t *p_buffer, uint32_t p_num_chars) {
+	// The buffer is assumed to include at least one character (for null terminator)
+	ERR_FAIL_COND_V(!p_num_chars, 0);
+
+	uint32_t num_read = MIN((uint64_t)p_num_chars, data.size() - pos);
+	const uint8_t *src = data.ptr() + pos;
+	for (uint32_t n = 0; n < num_read; n++) {
+		p_buffer[n] = src[n];
+	}
+	pos += num_read;
+
+	// could be less than p_num_chars, or zero
+	return num_read;
+}
+
+void VariantParser::StreamBuffer::set_data(const Vector<uint8_t> &p_data) {
+	data = p_data;
+	pos = 0;
+	_reset_readahead();
+}
+
+uint64_t VariantParser::StreamBuffer::get_position() const {
+	return pos - _get_readahead_pending();
+}
+
 bool VariantParser::StreamString::is_utf8() const {
 	return false;
 }
@@ -272,7 +307,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				[[fallthrough]];
 			}
 			case '"': {
-				String str;
+				StringBuffer<> str_buf;
 				char32_t prev = 0;
 				while (true) {
 					char32_t ch = p_stream->get_char();
@@ -375,7 +410,14 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							r_token.type = TK_ERROR;
 							return ERR_PARSE_ERROR;
 						}
-						str += res;
+						// Match String::operator+=, which drops NUL and replaces invalid code points.
+						if (res == 0) {
+							continue;
+						}
+						if (res > 0x10ffff) {
+							res = 0xfffd;
+						}
+						str_buf += res;
 					} else {
 						if (prev != 0) {
 							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
@@ -385,7 +427,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						if (ch == '\n') {
 							line++;
 						}
-						str += ch;
+						str_buf += ch;
 					}
 				}
 				if (prev != 0) {
@@ -394,6 +436,8 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return ERR_PARSE_ERROR;
 				}
 
+				String str = str_buf.as_string();
+
 				if (p_stream->is_utf8()) {
 					str.parse_utf8(str.ascii(true).get_data());
 				}
@@ -1370,17 +1414,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
 			Vector<int32_t> args;
 			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
@@ -1388,17 +1422,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedInt64Array") {
 			Vector<int64_t> args;
 			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
@@ -1406,17 +1430,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
 			Vector<float> args;
 			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
@@ -1424,17 +1438,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedFloat64Array") {
 			Vector<double> args;
 			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
@@ -1442,17 +1446,7 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
-			value = arr;
+			value = args;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
 			if (token.type != TK_PARENTHESIS_OPEN) {
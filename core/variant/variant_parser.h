@@ -45,15 +45,27 @@ public:
 		uint32_t readahead_filled = 0;
 		bool eof = false;
 
+		char32_t _get_char_slow();
+
 	protected:
 		bool readahead_enabled = true;
 		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
 		virtual bool _is_eof() const = 0;
 
+		// Number of characters read from the source but not yet returned by get_char().
+		uint32_t _get_readahead_pending() const { return readahead_filled > readahead_pointer ? readahead_filled - readahead_pointer : 0; }
+		void _reset_readahead();
+
 	public:
 		char32_t saved = 0;
 
-		char32_t get_char();
+		_FORCE_INLINE_ char32_t get_char() {
+			// Fast path, the tokenizer calls this for every character.
+			if (likely(readahead_pointer < readahead_filled)) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _get_char_slow();
+		}
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
@@ -74,6 +86,26 @@ public:
 		StreamFile(bool p_readahead_enabled = true) { readahead_enabled = p_readahead_enabled; }
 	};
 
+	// Reads from UTF-8 data already in memory, e.g. a whole file read at once.
+	struct StreamBuffer : public Stream {
+	private:
+		Vector<uint8_t> data;
+		uint64_t pos = 0;
+
+	protected:
+		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) override;
+		virtual bool _is_eof() const override;
+
+	public:
+		void set_data(const Vector<uint8_t> &p_data);
+		// Offset in the data of the next character get_char() will return.
+		uint64_t get_position() const;
+
+		virtual bool is_utf8() const override;
+
+		StreamBuffer(bool p_readahead_enabled = true) { readahead_enabled = p_readahead_enabled; }
+	};
+
 	struct StreamString : public Stream {
 		String s;
 
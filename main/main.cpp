@@ -3370,6 +3370,8 @@ Error Main::setup2(bool p_show_boot_logo) {
 		OS::get_singleton()->benchmark_end_measure("Startup", "Translations and Remaps");
 	}
 
+	ResourceCache::set_soft_cache_budget(uint64_t(int64_t(GLOBAL_GET("memory/limits/resource_soft_cache/budget_mb"))) * 1024 * 1024);
+
 	MAIN_PRINT("Main: Load TextServer");
 
 	/* Setup Text Server */
@@ -4752,6 +4754,8 @@ void Main::cleanup(bool p_force) {
 	}
 
 	ResourceLoader::clear_thread_load_tasks();
+	// Resources kept alive only by the soft cache may need servers to be freed.
+	ResourceCache::soft_cache_clear();
 
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
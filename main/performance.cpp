@@ -103,6 +103,8 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCES);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCE_SOFT_CACHE);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -157,6 +159,8 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("pipeline/compilations_surface"),
 		PNAME("pipeline/compilations_draw"),
 		PNAME("pipeline/compilations_specialization"),
+		PNAME("memory/resources"),
+		PNAME("memory/resource_soft_cache"),
 	};
 	static_assert((sizeof(names) / sizeof(const char *)) == MONITOR_MAX);
 
@@ -209,6 +213,10 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW);
 		case PIPELINE_COMPILATIONS_SPECIALIZATION:
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION);
+		case MEMORY_RESOURCES:
+			return ResourceCache::get_cached_memory_usage();
+		case MEMORY_RESOURCE_SOFT_CACHE:
+			return ResourceCache::get_soft_cache_memory_usage();
 
 #ifndef _PHYSICS_DISABLED
 		case PHYSICS_2D_ACTIVE_OBJECTS:
@@ -327,6 +335,8 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
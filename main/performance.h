@@ -106,6 +106,8 @@ public:
 		PIPELINE_COMPILATIONS_SURFACE,
 		PIPELINE_COMPILATIONS_DRAW,
 		PIPELINE_COMPILATIONS_SPECIALIZATION,
+		MEMORY_RESOURCES,
+		MEMORY_RESOURCE_SOFT_CACHE,
 		MONITOR_MAX
 	};
 
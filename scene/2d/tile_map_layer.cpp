@@ -31,9 +31,14 @@
 #include "tile_map_layer.h"
 
 #include "core/io/marshalls.h"
+#include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/tile_map.h"
 #include "scene/gui/control.h"
 #include "scene/resources/2d/world_2d.h"
+#include "scene/resources/compressed_texture.h"
+#include "scene/resources/image_texture.h"
+#include "scene/resources/portable_compressed_texture.h"
 
 #ifndef _NAVIGATION_DISABLED
 #include "servers/navigation_server_2d.h"
@@ -187,7 +192,7 @@ void TileMapLayer::_debug_quadrants_update_cell(CellData &r_cell_data, SelfList<
 #endif // DEBUG_ENABLED
 
 /////////////////////////////// Rendering //////////////////////////////////////
-void TileMapLayer::_rendering_update(bool p_force_cleanup) {
+void TileMapLayer::_rendering_update(bool p_force_cleanup, bool p_ignore_budget) {
 	RenderingServer *rs = RenderingServer::get_singleton();
 
 	// Check if we should cleanup everything.
@@ -210,17 +215,15 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 
 	// ----------- Quadrants processing -----------
 
-	// List all rendering quadrants to update, creating new ones if needed.
-	SelfList<RenderingQuadrant>::List dirty_rendering_quadrant_list;
-
 	// Check if anything changed that might change the quadrant shape.
 	// If so, recreate everything.
-	bool quadrant_shape_changed = dirty.flags[DIRTY_FLAGS_LAYER_Y_SORT_ENABLED] || dirty.flags[DIRTY_FLAGS_TILE_SET] ||
+	bool quadrant_shape_changed = dirty.flags[DIRTY_FLAGS_LAYER_Y_SORT_ENABLED] || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_RENDERING_QUADRANT_BAKED] ||
 			(is_y_sort_enabled() && (dirty.flags[DIRTY_FLAGS_LAYER_Y_SORT_ORIGIN] || dirty.flags[DIRTY_FLAGS_LAYER_X_DRAW_ORDER_REVERSED] || dirty.flags[DIRTY_FLAGS_LAYER_LOCAL_TRANSFORM])) ||
 			(!is_y_sort_enabled() && dirty.flags[DIRTY_FLAGS_LAYER_RENDERING_QUADRANT_SIZE]);
 
 	// Free all quadrants.
 	if (forced_cleanup || quadrant_shape_changed) {
+		rendering_dirty_quadrant_list.clear();
 		for (const KeyValue<Vector2i, Ref<RenderingQuadrant>> &kv : rendering_quadrant_map) {
 			for (const RID &ci : kv.value->canvas_items) {
 				if (ci.is_valid()) {
@@ -239,22 +242,27 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 			// Update all cells.
 			for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
 				CellData &cell_data = kv.value;
-				_rendering_quadrants_update_cell(cell_data, dirty_rendering_quadrant_list);
+				_rendering_quadrants_update_cell(cell_data, rendering_dirty_quadrant_list);
 			}
 		} else {
 			// Update dirty cells.
 			for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
 				CellData &cell_data = *cell_data_list_element->self();
-				_rendering_quadrants_update_cell(cell_data, dirty_rendering_quadrant_list);
+				_rendering_quadrants_update_cell(cell_data, rendering_dirty_quadrant_list);
 			}
 		}
 
-		// Update all dirty quadrants.
-		bool needs_set_not_interpolated = is_inside_tree() && get_tree()->is_physics_interpolation_enabled() && !is_physics_interpolated();
-		for (SelfList<RenderingQuadrant> *quadrant_list_element = dirty_rendering_quadrant_list.first(); quadrant_list_element;) {
-			SelfList<RenderingQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
-
-			const Ref<RenderingQuadrant> &rendering_quadrant = quadrant_list_element->self();
+		// Take the dirty quadrants to rebuild in this update. Runtime tile data only lives for one update, so it disables the budget.
+		bool use_budget = !p_ignore_budget && rendering_quadrant_updates_per_frame > 0 && !_uses_runtime_tile_data_update();
+		LocalVector<RenderingQuadrantBuild> builds;
+		const bool sort_x_reversed = is_y_sort_enabled() && x_draw_order_reversed;
+		const Color self_modulate = get_self_modulate();
+		int taken = 0;
+		while (rendering_dirty_quadrant_list.first() && (!use_budget || taken < rendering_quadrant_updates_per_frame)) {
+			SelfList<RenderingQuadrant> *quadrant_list_element = rendering_dirty_quadrant_list.first();
+			Ref<RenderingQuadrant> rendering_quadrant = quadrant_list_element->self();
+			quadrant_list_element->remove_from_list();
+			taken++;
 
 			// Check if the quadrant has a tile.
 			bool has_a_tile = false;
@@ -267,103 +275,11 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 			}
 
 			if (has_a_tile) {
-				// Process the quadrant.
-
-				// First, clear the quadrant's canvas items.
-				for (RID &ci : rendering_quadrant->canvas_items) {
-					rs->free(ci);
-				}
-				rendering_quadrant->canvas_items.clear();
-
-				// Sort the quadrant cells.
-				if (is_y_sort_enabled() && x_draw_order_reversed) {
-					rendering_quadrant->cells.sort_custom<CellDataYSortedXReversedComparator>();
-				} else {
-					rendering_quadrant->cells.sort();
-				}
-
-				// Those allow to group cell per material or z-index.
-				Ref<Material> prev_material;
-				int prev_z_index = 0;
-				RID prev_ci;
-
-				for (SelfList<CellData> *cell_data_quadrant_list_element = rendering_quadrant->cells.first(); cell_data_quadrant_list_element; cell_data_quadrant_list_element = cell_data_quadrant_list_element->next()) {
-					CellData &cell_data = *cell_data_quadrant_list_element->self();
-
-					TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(cell_data.cell.source_id));
-
-					// Get the tile data.
-					const TileData *tile_data;
-					if (cell_data.runtime_tile_data_cache) {
-						tile_data = cell_data.runtime_tile_data_cache;
-					} else {
-						tile_data = atlas_source->get_tile_data(cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile);
-					}
-
-					Ref<Material> mat = tile_data->get_material();
-					int tile_z_index = tile_data->get_z_index();
-
-					// Quandrant pos.
-
-					// --- CanvasItems ---
-					RID ci;
-
-					// Check if the material or the z_index changed.
-					if (prev_ci == RID() || prev_material != mat || prev_z_index != tile_z_index) {
-						// If so, create a new CanvasItem.
-						ci = rs->canvas_item_create();
-						if (needs_set_not_interpolated) {
-							rs->canvas_item_set_interpolated(ci, false);
-						}
-						if (mat.is_valid()) {
-							rs->canvas_item_set_material(ci, mat->get_rid());
-						}
-						rs->canvas_item_set_parent(ci, get_canvas_item());
-						rs->canvas_item_set_use_parent_material(ci, mat.is_null());
-
-						Transform2D xform(0, rendering_quadrant->canvas_items_position);
-						rs->canvas_item_set_transform(ci, xform);
-
-						rs->canvas_item_set_light_mask(ci, get_light_mask());
-						rs->canvas_item_set_z_as_relative_to_parent(ci, true);
-						rs->canvas_item_set_z_index(ci, tile_z_index);
-
-						rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(get_texture_filter_in_tree()));
-						rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(get_texture_repeat_in_tree()));
-
-						rendering_quadrant->canvas_items.push_back(ci);
-
-						prev_ci = ci;
-						prev_material = mat;
-						prev_z_index = tile_z_index;
-
-					} else {
-						// Keep the same canvas_item to draw on.
-						ci = prev_ci;
-					}
-
-					const Vector2 local_tile_pos = tile_set->map_to_local(cell_data.coords);
-
-					// Random animation offset.
-					real_t random_animation_offset = 0.0;
-					if (atlas_source->get_tile_animation_mode(cell_data.cell.get_atlas_coords()) != TileSetAtlasSource::TILE_ANIMATION_MODE_DEFAULT) {
-						Array to_hash;
-						to_hash.push_back(local_tile_pos);
-						to_hash.push_back(get_instance_id()); // Use instance id as a random hash
-						random_animation_offset = RandomPCG(to_hash.hash()).randf();
-					}
-
-					// Drawing the tile in the canvas item.
-					draw_tile(ci, local_tile_pos - rendering_quadrant->canvas_items_position, tile_set, cell_data.cell.source_id, cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile, -1, get_self_modulate(), tile_data, random_animation_offset);
-				}
-
-				// Reset physics interpolation for any recreated canvas items.
-				if (is_physics_interpolated_and_enabled() && is_visible_in_tree()) {
-					for (const RID &ci : rendering_quadrant->canvas_items) {
-						rs->canvas_item_reset_physics_interpolation(ci);
-					}
-				}
-
+				builds.push_back(RenderingQuadrantBuild());
+				RenderingQuadrantBuild &build = builds[builds.size() - 1];
+				build.quadrant = rendering_quadrant.ptr();
+				build.sort_x_reversed = sort_x_reversed;
+				build.self_modulate = self_modulate;
 			} else {
 				// Free the quadrant.
 				for (const RID &ci : rendering_quadrant->canvas_items) {
@@ -374,11 +290,26 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 				rendering_quadrant->cells.clear();
 				rendering_quadrant_map.erase(rendering_quadrant->quadrant_coords);
 			}
+		}
 
-			quadrant_list_element = next_quadrant_list_element;
+		// Build the draw commands of the quadrants, in parallel when there are several of them.
+		if (rendering_quadrant_baked && !builds.is_empty()) {
+			_rendering_resolve_bake_textures();
+		}
+		if (builds.size() >= RENDERING_QUADRANT_THREADED_BUILD_MIN) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &TileMapLayer::_rendering_build_quadrant_task, builds.ptr(), builds.size(), -1, true, SNAME("TileMapLayerBuildQuadrants"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (RenderingQuadrantBuild &build : builds) {
+				_rendering_build_quadrant(build);
+			}
 		}
 
-		dirty_rendering_quadrant_list.clear();
+		// Commit them to the rendering server.
+		bool needs_set_not_interpolated = is_inside_tree() && get_tree()->is_physics_interpolation_enabled() && !is_physics_interpolated();
+		for (RenderingQuadrantBuild &build : builds) {
+			_rendering_commit_quadrant(build, needs_set_not_interpolated);
+		}
 
 		// Reset the drawing indices.
 		{
@@ -442,6 +373,210 @@ void TileMapLayer::_rendering_update(bool p_force_cleanup) {
 	_rendering_was_cleaned_up = forced_cleanup || !occlusion_enabled;
 }
 
+void TileMapLayer::_rendering_build_quadrant(RenderingQuadrantBuild &r_build) const {
+	RenderingQuadrant *rendering_quadrant = r_build.quadrant;
+
+	// Sort the quadrant cells.
+	if (r_build.sort_x_reversed) {
+		rendering_quadrant->cells.sort_custom<CellDataYSortedXReversedComparator>();
+	} else {
+		rendering_quadrant->cells.sort();
+	}
+
+	// Group cells per material or z-index.
+	RenderingCanvasItemBuild *canvas_item = nullptr;
+
+	for (SelfList<CellData> *cell_data_quadrant_list_element = rendering_quadrant->cells.first(); cell_data_quadrant_list_element; cell_data_quadrant_list_element = cell_data_quadrant_list_element->next()) {
+		const CellData &cell_data = *cell_data_quadrant_list_element->self();
+
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(cell_data.cell.source_id));
+
+		// Get the tile data.
+		const TileData *tile_data;
+		if (cell_data.runtime_tile_data_cache) {
+			tile_data = cell_data.runtime_tile_data_cache;
+		} else {
+			tile_data = atlas_source->get_tile_data(cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile);
+		}
+
+		Ref<Material> mat = tile_data->get_material();
+		int tile_z_index = tile_data->get_z_index();
+
+		// Check if the material or the z_index changed.
+		if (!canvas_item || canvas_item->material != mat || canvas_item->z_index != tile_z_index) {
+			// If so, start a new CanvasItem.
+			r_build.canvas_items.push_back(RenderingCanvasItemBuild());
+			canvas_item = &r_build.canvas_items[r_build.canvas_items.size() - 1];
+			canvas_item->material = mat;
+			canvas_item->z_index = tile_z_index;
+		}
+
+		const Vector2 local_tile_pos = tile_set->map_to_local(cell_data.coords);
+		const Vector2 position = local_tile_pos - rendering_quadrant->canvas_items_position;
+
+		if (rendering_quadrant_baked) {
+			const RenderingBakeTexture *bake_texture = rendering_bake_textures.getptr(cell_data.cell.source_id);
+			if (bake_texture && _rendering_bake_tile(*canvas_item, position, r_build.self_modulate, *bake_texture, atlas_source, cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile, tile_data)) {
+				continue;
+			}
+		}
+
+		RenderingTileDraw draw;
+		draw.cell_data = &cell_data;
+		draw.tile_data = tile_data;
+		draw.position = position;
+
+		// Random animation offset.
+		if (atlas_source->get_tile_animation_mode(cell_data.cell.get_atlas_coords()) != TileSetAtlasSource::TILE_ANIMATION_MODE_DEFAULT) {
+			Array to_hash;
+			to_hash.push_back(local_tile_pos);
+			to_hash.push_back(get_instance_id()); // Use instance id as a random hash
+			draw.animation_offset = RandomPCG(to_hash.hash()).randf();
+		}
+
+		canvas_item->draws.push_back(draw);
+	}
+}
+
+void TileMapLayer::_rendering_build_quadrant_task(uint32_t p_index, RenderingQuadrantBuild *p_builds) {
+	_rendering_build_quadrant(p_builds[p_index]);
+}
+
+void TileMapLayer::_rendering_commit_quadrant(RenderingQuadrantBuild &r_build, bool p_set_not_interpolated) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RenderingQuadrant *rendering_quadrant = r_build.quadrant;
+
+	// First, clear the quadrant's canvas items.
+	for (RID &ci : rendering_quadrant->canvas_items) {
+		rs->free(ci);
+	}
+	rendering_quadrant->canvas_items.clear();
+
+	for (const RenderingCanvasItemBuild &canvas_item : r_build.canvas_items) {
+		RID ci = rs->canvas_item_create();
+		if (p_set_not_interpolated) {
+			rs->canvas_item_set_interpolated(ci, false);
+		}
+		if (canvas_item.material.is_valid()) {
+			rs->canvas_item_set_material(ci, canvas_item.material->get_rid());
+		}
+		rs->canvas_item_set_parent(ci, get_canvas_item());
+		rs->canvas_item_set_use_parent_material(ci, canvas_item.material.is_null());
+
+		Transform2D xform(0, rendering_quadrant->canvas_items_position);
+		rs->canvas_item_set_transform(ci, xform);
+
+		rs->canvas_item_set_light_mask(ci, get_light_mask());
+		rs->canvas_item_set_z_as_relative_to_parent(ci, true);
+		rs->canvas_item_set_z_index(ci, canvas_item.z_index);
+
+		rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(get_texture_filter_in_tree()));
+		rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(get_texture_repeat_in_tree()));
+
+		rendering_quadrant->canvas_items.push_back(ci);
+
+		// Drawing the tiles in the canvas item.
+		for (const RenderingTileDraw &draw : canvas_item.draws) {
+			if (draw.baked_run >= 0) {
+				const RenderingBakedRun &run = canvas_item.baked_runs[draw.baked_run];
+				rs->canvas_item_add_triangle_array(ci, run.indices, run.points, run.colors, run.uvs, Vector<int>(), Vector<float>(), run.texture);
+			} else {
+				const TileMapCell &cell = draw.cell_data->cell;
+				draw_tile(ci, draw.position, tile_set, cell.source_id, cell.get_atlas_coords(), cell.alternative_tile, -1, r_build.self_modulate, draw.tile_data, draw.animation_offset);
+			}
+		}
+	}
+
+	// Reset physics interpolation for any recreated canvas items.
+	if (is_physics_interpolated_and_enabled() && is_visible_in_tree()) {
+		for (const RID &ci : rendering_quadrant->canvas_items) {
+			rs->canvas_item_reset_physics_interpolation(ci);
+		}
+	}
+}
+
+void TileMapLayer::_rendering_resolve_bake_textures() {
+	rendering_bake_textures.clear();
+	for (int i = 0; i < tile_set->get_source_count(); i++) {
+		const int source_id = tile_set->get_source_id(i);
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(source_id));
+		if (!atlas_source) {
+			continue;
+		}
+
+		// Only merge textures that are drawn as a plain rect. Others may remap the region or carry a normal map.
+		Ref<Texture2D> tex = atlas_source->get_runtime_texture();
+		if (!Object::cast_to<ImageTexture>(*tex) && !Object::cast_to<CompressedTexture2D>(*tex) && !Object::cast_to<PortableCompressedTexture2D>(*tex)) {
+			continue;
+		}
+		Vector2 tex_size = tex->get_size();
+		if (tex_size.x <= 0 || tex_size.y <= 0) {
+			continue;
+		}
+
+		RenderingBakeTexture &bake_texture = rendering_bake_textures[source_id];
+		bake_texture.rid = tex->get_rid();
+		bake_texture.size = tex_size;
+	}
+}
+
+bool TileMapLayer::_rendering_bake_tile(RenderingCanvasItemBuild &r_canvas_item, const Vector2 &p_position, const Color &p_self_modulate, const RenderingBakeTexture &p_texture, TileSetAtlasSource *p_atlas_source, const Vector2i &p_atlas_coords, int p_alternative_tile, const TileData *p_tile_data) const {
+	// Animated tiles need animation slices, and clipped UVs need a per-rect flag.
+	if (tile_set->is_uv_clipping() || p_atlas_source->get_tile_animation_frames_count(p_atlas_coords) != 1) {
+		return false;
+	}
+
+	Vector2i grid_size = p_atlas_source->get_atlas_grid_size();
+	if (p_atlas_coords.x >= grid_size.x || p_atlas_coords.y >= grid_size.y) {
+		return false;
+	}
+
+	// Extend the last run only if nothing else was drawn since, so the draw order is kept.
+	const RID &tex_rid = p_texture.rid;
+	const Vector2 &tex_size = p_texture.size;
+	uint32_t draw_count = r_canvas_item.draws.size();
+	if (draw_count == 0 || r_canvas_item.draws[draw_count - 1].baked_run < 0 || r_canvas_item.baked_runs[r_canvas_item.baked_runs.size() - 1].texture != tex_rid) {
+		RenderingTileDraw draw;
+		draw.baked_run = r_canvas_item.baked_runs.size();
+		r_canvas_item.draws.push_back(draw);
+		r_canvas_item.baked_runs.push_back(RenderingBakedRun());
+		r_canvas_item.baked_runs[draw.baked_run].texture = tex_rid;
+	}
+	RenderingBakedRun &run = r_canvas_item.baked_runs[r_canvas_item.baked_runs.size() - 1];
+
+	// Same placement as draw_tile(), expanded to the corners the rect would be drawn with.
+	Rect2i source_rect = p_atlas_source->get_runtime_tile_texture_region(p_atlas_coords, 0);
+	Vector2 size = Vector2(source_rect.size) + Vector2(FP_ADJUST, FP_ADJUST);
+	Vector2 tile_offset = p_tile_data->get_texture_origin();
+
+	bool transpose = p_tile_data->get_transpose() ^ bool(p_alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+	bool flip_h = p_tile_data->get_flip_h() ^ bool(p_alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
+	bool flip_v = p_tile_data->get_flip_v() ^ bool(p_alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
+	if (transpose) {
+		SWAP(size.x, size.y);
+	}
+	Vector2 position = p_position - size / 2 - tile_offset;
+
+	Color modulate = p_tile_data->get_modulate() * p_self_modulate;
+
+	static const Vector2 corners[4] = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+	int base = run.points.size();
+	for (const Vector2 &corner : corners) {
+		Vector2 vertex_base = Vector2(flip_h ? 1 - corner.x : corner.x, flip_v ? 1 - corner.y : corner.y);
+		Vector2 uv_base = transpose ? Vector2(corner.y, corner.x) : corner;
+		run.points.push_back(position + size * vertex_base);
+		run.uvs.push_back((Vector2(source_rect.position) + Vector2(source_rect.size) * uv_base) / tex_size);
+		run.colors.push_back(modulate);
+	}
+	run.indices.push_back(base);
+	run.indices.push_back(base + 1);
+	run.indices.push_back(base + 2);
+	run.indices.push_back(base);
+	run.indices.push_back(base + 2);
+	run.indices.push_back(base + 3);
+	return true;
+}
+
 void TileMapLayer::_rendering_notification(int p_what) {
 	RenderingServer *rs = RenderingServer::get_singleton();
 	if (p_what == NOTIFICATION_TRANSFORM_CHANGED || p_what == NOTIFICATION_ENTER_CANVAS || p_what == NOTIFICATION_VISIBILITY_CHANGED) {
@@ -707,32 +842,73 @@ void TileMapLayer::_rendering_draw_cell_debug(const RID &p_canvas_item, const Ve
 
 /////////////////////////////// Physics //////////////////////////////////////
 #ifndef _PHYSICS_DISABLED
+constexpr int TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE = 16;
+
+Vector2i TileMapLayer::_coords_to_physics_merged_quadrant_coords(const Vector2i &p_coords) const {
+	return Vector2i(
+			p_coords.x > 0 ? p_coords.x / TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE : (p_coords.x - (TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE - 1)) / TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE,
+			p_coords.y > 0 ? p_coords.y / TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE : (p_coords.y - (TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE - 1)) / TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE);
+}
+
 void TileMapLayer::_physics_update(bool p_force_cleanup) {
 	// Check if we should cleanup everything.
 	bool forced_cleanup = p_force_cleanup || !enabled || !collision_enabled || !is_inside_tree() || tile_set.is_null();
+
+	// Runtime tile data only exists for the cells updated this frame, so it cannot be merged with the rest of a quadrant.
+	bool merge_collisions = !forced_cleanup && collision_merged && !_uses_runtime_tile_data_update();
+
 	if (forced_cleanup) {
 		// Clean everything.
 		for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
 			_physics_clear_cell(kv.value);
 		}
+		_physics_clear_merged_quadrants();
 	} else {
-		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES] || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE]) {
+		HashSet<Vector2i> dirty_merged_quadrants;
+		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_SET] || dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES] || dirty.flags[DIRTY_FLAGS_LAYER_IN_TREE] || dirty.flags[DIRTY_FLAGS_LAYER_COLLISION_MERGED] || merge_collisions != _physics_was_merging_collisions) {
 			// Update all cells.
+			_physics_clear_merged_quadrants();
 			for (KeyValue<Vector2i, CellData> &kv : tile_map_layer_data) {
-				_physics_update_cell(kv.value);
+				_physics_update_cell(kv.value, merge_collisions);
+				if (merge_collisions) {
+					dirty_merged_quadrants.insert(_coords_to_physics_merged_quadrant_coords(kv.key));
+				}
 			}
 		} else {
 			// Update dirty cells.
 			for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
 				CellData &cell_data = *cell_data_list_element->self();
-				_physics_update_cell(cell_data);
+				_physics_update_cell(cell_data, merge_collisions);
+				if (merge_collisions) {
+					dirty_merged_quadrants.insert(_coords_to_physics_merged_quadrant_coords(cell_data.coords));
+				}
 			}
 		}
+
+		// Rebuild the merged bodies of the quadrants with modified cells. The shapes are computed in parallel when there are several quadrants.
+		LocalVector<PhysicsMergedQuadrantBuild> builds;
+		builds.resize(dirty_merged_quadrants.size());
+		uint32_t build_index = 0;
+		for (const Vector2i &quadrant_coords : dirty_merged_quadrants) {
+			builds[build_index++].quadrant_coords = quadrant_coords;
+		}
+		if (builds.size() >= PHYSICS_MERGED_QUADRANT_THREADED_BUILD_MIN) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &TileMapLayer::_physics_build_merged_quadrant_task, builds.ptr(), builds.size(), -1, true, SNAME("TileMapLayerBuildMergedCollisions"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (PhysicsMergedQuadrantBuild &build : builds) {
+				_physics_build_merged_quadrant(build);
+			}
+		}
+		for (const PhysicsMergedQuadrantBuild &build : builds) {
+			_physics_commit_merged_quadrant(build);
+		}
 	}
 
 	// -----------
 	// Mark the physics state as up to date.
 	_physics_was_cleaned_up = forced_cleanup;
+	_physics_was_merging_collisions = merge_collisions;
 }
 
 void TileMapLayer::_physics_notification(int p_what) {
@@ -754,6 +930,15 @@ void TileMapLayer::_physics_notification(int p_what) {
 						}
 					}
 				}
+				for (KeyValue<Vector2i, PhysicsMergedQuadrant> &kv : physics_merged_quadrant_map) {
+					Transform2D xform(0, tile_set->map_to_local(kv.key * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE));
+					xform = gl_transform * xform;
+					for (RID body : kv.value.bodies) {
+						if (body.is_valid()) {
+							ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+						}
+					}
+				}
 			}
 			break;
 		case NOTIFICATION_ENTER_TREE:
@@ -770,6 +955,13 @@ void TileMapLayer::_physics_notification(int p_what) {
 						}
 					}
 				}
+				for (KeyValue<Vector2i, PhysicsMergedQuadrant> &kv : physics_merged_quadrant_map) {
+					for (RID body : kv.value.bodies) {
+						if (body.is_valid()) {
+							ps->body_set_space(body, space);
+						}
+					}
+				}
 			}
 	}
 }
@@ -787,7 +979,7 @@ void TileMapLayer::_physics_clear_cell(CellData &r_cell_data) {
 	r_cell_data.bodies.clear();
 }
 
-void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
+void TileMapLayer::_physics_update_cell(CellData &r_cell_data, bool p_merge_collisions) {
 	Transform2D gl_transform = get_global_transform();
 	RID space = get_world_2d()->get_space();
 	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
@@ -832,8 +1024,8 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 					real_t physics_priority = tile_set->get_physics_layer_collision_priority(tile_set_physics_layer);
 
 					RID body = r_cell_data.bodies[tile_set_physics_layer];
-					if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
-						// No body needed, free it if it exists.
+					if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0 || (p_merge_collisions && _physics_is_tile_mergeable(tile_data, tile_set_physics_layer))) {
+						// No body needed (or the quadrant body holds the shapes), free it if it exists.
 						if (body.is_valid()) {
 							bodies_coords.erase(body);
 							ps->free(body);
@@ -903,6 +1095,270 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 	_physics_clear_cell(r_cell_data);
 }
 
+bool TileMapLayer::_physics_is_tile_mergeable(const TileData *p_tile_data, int p_physics_layer) const {
+	// Merged shapes share a body, so they cannot keep per-tile body state or one-way collisions.
+	if (p_tile_data->get_constant_linear_velocity(p_physics_layer) != Vector2() || p_tile_data->get_constant_angular_velocity(p_physics_layer) != 0.0) {
+		return false;
+	}
+	for (int polygon_index = 0; polygon_index < p_tile_data->get_collision_polygons_count(p_physics_layer); polygon_index++) {
+		if (p_tile_data->is_collision_polygon_one_way(p_physics_layer, polygon_index)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void TileMapLayer::_physics_clear_merged_quadrant(PhysicsMergedQuadrant &r_quadrant) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	for (const RID &body : r_quadrant.bodies) {
+		if (body.is_valid()) {
+			bodies_coords.erase(body);
+			ps->free(body);
+		}
+	}
+	r_quadrant.bodies.clear();
+	for (const RID &shape : r_quadrant.shapes) {
+		ps->free(shape);
+	}
+	r_quadrant.shapes.clear();
+}
+
+void TileMapLayer::_physics_clear_merged_quadrants() {
+	for (KeyValue<Vector2i, PhysicsMergedQuadrant> &kv : physics_merged_quadrant_map) {
+		_physics_clear_merged_quadrant(kv.value);
+	}
+	physics_merged_quadrant_map.clear();
+}
+
+void TileMapLayer::_physics_build_merged_quadrant(PhysicsMergedQuadrantBuild &r_build) const {
+	// Only reads the layer and the TileSet, so that quadrants can be built on worker threads.
+	const Vector2i first_cell = r_build.quadrant_coords * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE;
+	const Vector2 quadrant_origin = tile_set->map_to_local(first_cell);
+
+	// Full-tile squares are merged into greedy rectangles. Anything else is unioned into polygons.
+	const bool square_tiles = tile_set->get_tile_shape() == TileSet::TILE_SHAPE_SQUARE;
+	const Vector2 tile_size = tile_set->get_tile_size();
+	const Rect2 full_tile_rect = Rect2(-tile_size / 2, tile_size);
+
+	r_build.convex_polygons.resize(tile_set->get_physics_layers_count());
+	for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+		LocalVector<bool> solid;
+		solid.resize(TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE);
+		for (bool &is_solid : solid) {
+			is_solid = false;
+		}
+		LocalVector<Vector<Vector2>> polygons;
+
+		for (int y = 0; y < TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE; y++) {
+			for (int x = 0; x < TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE; x++) {
+				const CellData *cell_data = tile_map_layer_data.getptr(first_cell + Vector2i(x, y));
+				if (!cell_data) {
+					continue;
+				}
+				const TileMapCell &c = cell_data->cell;
+				if (!tile_set->has_source(c.source_id)) {
+					continue;
+				}
+				TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(c.source_id));
+				if (!atlas_source || !atlas_source->has_tile(c.get_atlas_coords()) || !atlas_source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+					continue;
+				}
+				const TileData *tile_data = atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+				if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0 || !_physics_is_tile_mergeable(tile_data, tile_set_physics_layer)) {
+					continue;
+				}
+
+				bool flip_h = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_H);
+				bool flip_v = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_FLIP_V);
+				bool transpose = (c.alternative_tile & TileSetAtlasSource::TRANSFORM_TRANSPOSE);
+				Vector2 cell_offset = tile_set->map_to_local(cell_data->coords) - quadrant_origin;
+
+				// The untransformed shapes are transformed here, as TileData caches transformed shapes on demand.
+				LocalVector<Vector<Vector2>> cell_polygons;
+				for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+					int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+					for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+						Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
+						if (shape.is_null()) {
+							continue;
+						}
+						if (flip_h || flip_v || transpose) {
+							cell_polygons.push_back(TileData::get_transformed_vertices(shape->get_points(), flip_h, flip_v, transpose));
+						} else {
+							cell_polygons.push_back(shape->get_points());
+						}
+					}
+				}
+
+				if (square_tiles && cell_polygons.size() == 1 && cell_polygons[0].size() == 4) {
+					Rect2 bounds(cell_polygons[0][0], Vector2());
+					for (const Vector2 &point : cell_polygons[0]) {
+						bounds.expand_to(point);
+					}
+					if (bounds.is_equal_approx(full_tile_rect)) {
+						solid[y * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE + x] = true;
+						continue;
+					}
+				}
+
+				for (Vector<Vector2> &polygon : cell_polygons) {
+					for (Vector2 &point : polygon) {
+						point += cell_offset;
+					}
+					polygons.push_back(polygon);
+				}
+			}
+		}
+
+		// Greedy rectangles over the full-tile squares.
+		for (int y = 0; y < TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE; y++) {
+			for (int x = 0; x < TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE; x++) {
+				if (!solid[y * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE + x]) {
+					continue;
+				}
+				int width = 1;
+				while (x + width < TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE && solid[y * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE + x + width]) {
+					width++;
+				}
+				int height = 1;
+				while (y + height < TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE) {
+					bool row_solid = true;
+					for (int i = 0; i < width && row_solid; i++) {
+						row_solid = solid[(y + height) * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE + x + i];
+					}
+					if (!row_solid) {
+						break;
+					}
+					height++;
+				}
+				for (int j = 0; j < height; j++) {
+					for (int i = 0; i < width; i++) {
+						solid[(y + j) * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE + x + i] = false;
+					}
+				}
+
+				Vector2 from = tile_set->map_to_local(first_cell + Vector2i(x, y)) - quadrant_origin - tile_size / 2;
+				Vector2 to = from + tile_size * Vector2(width, height);
+				Vector<Vector2> rect_polygon = { from, Vector2(to.x, from.y), to, Vector2(from.x, to.y) };
+				polygons.push_back(rect_polygon);
+			}
+		}
+
+		// Union touching polygons. Merges creating holes or disjoint parts are skipped.
+		struct MergedPolygon {
+			Vector<Vector2> polygon;
+			Rect2 bounds;
+			LocalVector<Vector<Vector2>> sources; // Convex, used as-is if the union cannot be decomposed.
+		};
+		LocalVector<MergedPolygon> merged_polygons;
+		for (const Vector<Vector2> &polygon : polygons) {
+			MergedPolygon current;
+			current.polygon = polygon;
+			current.bounds = Rect2(polygon[0], Vector2());
+			for (const Vector2 &point : polygon) {
+				current.bounds.expand_to(point);
+			}
+			current.sources.push_back(polygon);
+			for (uint32_t i = 0; i < merged_polygons.size();) {
+				MergedPolygon &other = merged_polygons[i];
+				if (!other.bounds.grow(CMP_EPSILON).intersects(current.bounds, true)) {
+					i++;
+					continue;
+				}
+				Vector<Vector<Vector2>> result = Geometry2D::merge_polygons(other.polygon, current.polygon);
+				if (result.size() != 1) {
+					i++;
+					continue;
+				}
+				current.polygon = result[0];
+				current.bounds = current.bounds.merge(other.bounds);
+				for (const Vector<Vector2> &source : other.sources) {
+					current.sources.push_back(source);
+				}
+				merged_polygons.remove_at_unordered(i);
+				// The grown polygon may now touch polygons that were already checked.
+				i = 0;
+			}
+			merged_polygons.push_back(current);
+		}
+
+		LocalVector<Vector<Vector2>> &convex_polygons = r_build.convex_polygons[tile_set_physics_layer];
+		for (const MergedPolygon &merged_polygon : merged_polygons) {
+			Vector<Vector<Vector2>> decomposed;
+			if (merged_polygon.sources.size() > 1) {
+				decomposed = Geometry2D::decompose_polygon_in_convex(merged_polygon.polygon);
+			}
+			if (decomposed.is_empty()) {
+				for (const Vector<Vector2> &source : merged_polygon.sources) {
+					convex_polygons.push_back(source);
+				}
+			} else {
+				for (const Vector<Vector2> &convex_polygon : decomposed) {
+					convex_polygons.push_back(convex_polygon);
+				}
+			}
+		}
+	}
+}
+
+void TileMapLayer::_physics_build_merged_quadrant_task(uint32_t p_index, PhysicsMergedQuadrantBuild *p_builds) {
+	_physics_build_merged_quadrant(p_builds[p_index]);
+}
+
+void TileMapLayer::_physics_commit_merged_quadrant(const PhysicsMergedQuadrantBuild &p_build) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	PhysicsMergedQuadrant &quadrant = physics_merged_quadrant_map[p_build.quadrant_coords];
+	_physics_clear_merged_quadrant(quadrant);
+
+	const Vector2i first_cell = p_build.quadrant_coords * TILE_MAP_PHYSICS_MERGED_QUADRANT_SIZE;
+	const Vector2 quadrant_origin = tile_set->map_to_local(first_cell);
+
+	bool has_shapes = false;
+	for (uint32_t tile_set_physics_layer = 0; tile_set_physics_layer < p_build.convex_polygons.size(); tile_set_physics_layer++) {
+		const LocalVector<Vector<Vector2>> &convex_polygons = p_build.convex_polygons[tile_set_physics_layer];
+		if (convex_polygons.is_empty()) {
+			continue;
+		}
+
+		if (quadrant.bodies.is_empty()) {
+			quadrant.bodies.resize(p_build.convex_polygons.size());
+		}
+		RID body = ps->body_create();
+		quadrant.bodies[tile_set_physics_layer] = body;
+		bodies_coords[body] = first_cell;
+
+		Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
+		ps->body_set_mode(body, use_kinematic_bodies ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+		ps->body_set_space(body, get_world_2d()->get_space());
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, get_global_transform() * Transform2D(0, quadrant_origin));
+		ps->body_attach_object_instance_id(body, tile_map_node ? tile_map_node->get_instance_id() : get_instance_id());
+		ps->body_set_collision_layer(body, tile_set->get_physics_layer_collision_layer(tile_set_physics_layer));
+		ps->body_set_collision_mask(body, tile_set->get_physics_layer_collision_mask(tile_set_physics_layer));
+		ps->body_set_collision_priority(body, tile_set->get_physics_layer_collision_priority(tile_set_physics_layer));
+		ps->body_set_pickable(body, false);
+		if (physics_material.is_null()) {
+			ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+			ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+		} else {
+			ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+			ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+		}
+
+		for (const Vector<Vector2> &convex_polygon : convex_polygons) {
+			RID shape = ps->convex_polygon_shape_create();
+			ps->shape_set_data(shape, convex_polygon);
+			ps->body_add_shape(body, shape);
+			quadrant.shapes.push_back(shape);
+		}
+		has_shapes = true;
+	}
+
+	if (!has_shapes) {
+		physics_merged_quadrant_map.erase(p_build.quadrant_coords);
+	}
+}
+
 #ifdef DEBUG_ENABLED
 void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data) {
 	// Draw the debug collision shapes.
@@ -1398,6 +1854,10 @@ void TileMapLayer::_build_runtime_update_tile_data(bool p_force_cleanup) {
 	_runtime_update_tile_data_was_cleaned_up = forced_cleanup;
 }
 
+bool TileMapLayer::_uses_runtime_tile_data_update() const {
+	return GDVIRTUAL_IS_OVERRIDDEN(_use_tile_data_runtime_update) || (tile_map_node && tile_map_node->GDVIRTUAL_IS_OVERRIDDEN(_use_tile_data_runtime_update));
+}
+
 void TileMapLayer::_build_runtime_update_tile_data_for_cell(CellData &r_cell_data, bool p_use_tilemap_for_runtime, bool p_auto_add_to_dirty_list) {
 	TileMapCell &c = r_cell_data.cell;
 	TileSetSource *source;
@@ -1694,7 +2154,7 @@ void TileMapLayer::_deferred_internal_update() {
 	_internal_update(false);
 }
 
-void TileMapLayer::_internal_update(bool p_force_cleanup) {
+void TileMapLayer::_internal_update(bool p_force_cleanup, bool p_ignore_budget) {
 	// Find TileData that need a runtime modification.
 	// This may add cells to the dirty list if a runtime modification has been notified.
 	_build_runtime_update_tile_data(p_force_cleanup);
@@ -1704,7 +2164,7 @@ void TileMapLayer::_internal_update(bool p_force_cleanup) {
 	_update_cells_callback(p_force_cleanup);
 
 	// Update all subsystems.
-	_rendering_update(p_force_cleanup);
+	_rendering_update(p_force_cleanup, p_ignore_budget);
 #ifndef _PHYSICS_DISABLED
 	_physics_update(p_force_cleanup);
 #endif // !_PHYSICS_DISABLED
@@ -1742,6 +2202,9 @@ void TileMapLayer::_internal_update(bool p_force_cleanup) {
 	dirty.cell_list.clear();
 
 	pending_update = false;
+
+	// Continue the quadrant rebuilds that did not fit in the budget on the next frame.
+	set_process_internal(rendering_dirty_quadrant_list.first() != nullptr);
 }
 
 void TileMapLayer::_physics_interpolated_changed() {
@@ -1808,6 +2271,10 @@ void TileMapLayer::_notification(int p_what) {
 			dirty.flags[DIRTY_FLAGS_LAYER_VISIBILITY] = true;
 			_queue_internal_update();
 		} break;
+
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			_internal_update(false);
+		} break;
 	}
 
 	_rendering_notification(p_what);
@@ -1824,6 +2291,8 @@ void TileMapLayer::_bind_methods() {
 	// Generic cells manipulations and access.
 	ClassDB::bind_method(D_METHOD("set_cell", "coords", "source_id", "atlas_coords", "alternative_tile"), &TileMapLayer::set_cell, DEFVAL(TileSet::INVALID_SOURCE), DEFVAL(TileSetSource::INVALID_ATLAS_COORDS), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("erase_cell", "coords"), &TileMapLayer::erase_cell);
+	ClassDB::bind_method(D_METHOD("set_cells_in_rect", "rect", "cells"), &TileMapLayer::set_cells_in_rect);
+	ClassDB::bind_method(D_METHOD("get_cells_in_rect", "rect"), &TileMapLayer::get_cells_in_rect);
 	ClassDB::bind_method(D_METHOD("fix_invalid_tiles"), &TileMapLayer::fix_invalid_tiles);
 	ClassDB::bind_method(D_METHOD("clear"), &TileMapLayer::clear);
 
@@ -1881,11 +2350,17 @@ void TileMapLayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_x_draw_order_reversed"), &TileMapLayer::is_x_draw_order_reversed);
 	ClassDB::bind_method(D_METHOD("set_rendering_quadrant_size", "size"), &TileMapLayer::set_rendering_quadrant_size);
 	ClassDB::bind_method(D_METHOD("get_rendering_quadrant_size"), &TileMapLayer::get_rendering_quadrant_size);
+	ClassDB::bind_method(D_METHOD("set_rendering_quadrant_baked", "baked"), &TileMapLayer::set_rendering_quadrant_baked);
+	ClassDB::bind_method(D_METHOD("is_rendering_quadrant_baked"), &TileMapLayer::is_rendering_quadrant_baked);
+	ClassDB::bind_method(D_METHOD("set_rendering_quadrant_updates_per_frame", "count"), &TileMapLayer::set_rendering_quadrant_updates_per_frame);
+	ClassDB::bind_method(D_METHOD("get_rendering_quadrant_updates_per_frame"), &TileMapLayer::get_rendering_quadrant_updates_per_frame);
 
 	ClassDB::bind_method(D_METHOD("set_collision_enabled", "enabled"), &TileMapLayer::set_collision_enabled);
 	ClassDB::bind_method(D_METHOD("is_collision_enabled"), &TileMapLayer::is_collision_enabled);
 	ClassDB::bind_method(D_METHOD("set_use_kinematic_bodies", "use_kinematic_bodies"), &TileMapLayer::set_use_kinematic_bodies);
 	ClassDB::bind_method(D_METHOD("is_using_kinematic_bodies"), &TileMapLayer::is_using_kinematic_bodies);
+	ClassDB::bind_method(D_METHOD("set_collision_merged", "collision_merged"), &TileMapLayer::set_collision_merged);
+	ClassDB::bind_method(D_METHOD("is_collision_merged"), &TileMapLayer::is_collision_merged);
 	ClassDB::bind_method(D_METHOD("set_collision_visibility_mode", "visibility_mode"), &TileMapLayer::set_collision_visibility_mode);
 	ClassDB::bind_method(D_METHOD("get_collision_visibility_mode"), &TileMapLayer::get_collision_visibility_mode);
 
@@ -1914,11 +2389,14 @@ void TileMapLayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "y_sort_origin"), "set_y_sort_origin", "get_y_sort_origin");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "x_draw_order_reversed"), "set_x_draw_order_reversed", "is_x_draw_order_reversed");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "rendering_quadrant_size"), "set_rendering_quadrant_size", "get_rendering_quadrant_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "rendering_quadrant_baked"), "set_rendering_quadrant_baked", "is_rendering_quadrant_baked");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "rendering_quadrant_updates_per_frame", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_rendering_quadrant_updates_per_frame", "get_rendering_quadrant_updates_per_frame");
 
 #ifndef _PHYSICS_DISABLED
 	ADD_GROUP("Physics", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_enabled"), "set_collision_enabled", "is_collision_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_kinematic_bodies"), "set_use_kinematic_bodies", "is_using_kinematic_bodies");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_merged"), "set_collision_merged", "is_collision_merged");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_collision_visibility_mode", "get_collision_visibility_mode");
 #endif // !_PHYSICS_DISABLED
 
@@ -2391,7 +2869,7 @@ void TileMapLayer::draw_tile(RID p_canvas_item, const Vector2 &p_position, const
 void TileMapLayer::set_cell(const Vector2i &p_coords, int p_source_id, const Vector2i &p_atlas_coords, int p_alternative_tile) {
 	// Set the current cell tile (using integer position).
 	Vector2i pk(p_coords);
-	HashMap<Vector2i, CellData>::Iterator E = tile_map_layer_data.find(pk);
+	CellDataMap::Iterator E = tile_map_layer_data.find(pk);
 
 	int source_id = p_source_id;
 	Vector2i atlas_coords = p_atlas_coords;
@@ -2437,6 +2915,46 @@ void TileMapLayer::erase_cell(const Vector2i &p_coords) {
 	set_cell(p_coords, TileSet::INVALID_SOURCE, TileSetSource::INVALID_ATLAS_COORDS, TileSetSource::INVALID_TILE_ALTERNATIVE);
 }
 
+void TileMapLayer::set_cells_in_rect(const Rect2i &p_rect, const PackedInt32Array &p_cells) {
+	ERR_FAIL_COND_MSG(p_rect.size.x < 0 || p_rect.size.y < 0, "The rect size cannot be negative.");
+	ERR_FAIL_COND_MSG(p_cells.size() != (int64_t)p_rect.size.x * p_rect.size.y * 4, vformat("Expected 4 integers per cell of the rect (%d), got %d.", (int64_t)p_rect.size.x * p_rect.size.y * 4, p_cells.size()));
+
+	// Cells are stored row by row, as source ID, atlas X, atlas Y and alternative tile.
+	const int32_t *ptr = p_cells.ptr();
+	for (int y = p_rect.position.y; y < p_rect.get_end().y; y++) {
+		for (int x = p_rect.position.x; x < p_rect.get_end().x; x++) {
+			set_cell(Vector2i(x, y), ptr[0], Vector2i(ptr[1], ptr[2]), ptr[3]);
+			ptr += 4;
+		}
+	}
+}
+
+PackedInt32Array TileMapLayer::get_cells_in_rect(const Rect2i &p_rect) const {
+	PackedInt32Array cells;
+	ERR_FAIL_COND_V_MSG(p_rect.size.x < 0 || p_rect.size.y < 0, cells, "The rect size cannot be negative.");
+	cells.resize((int64_t)p_rect.size.x * p_rect.size.y * 4);
+
+	int32_t *ptr = cells.ptrw();
+	for (int y = p_rect.position.y; y < p_rect.get_end().y; y++) {
+		for (int x = p_rect.position.x; x < p_rect.get_end().x; x++) {
+			const CellData *cell_data = tile_map_layer_data.getptr(Vector2i(x, y));
+			if (cell_data) {
+				ptr[0] = cell_data->cell.source_id;
+				ptr[1] = cell_data->cell.coord_x;
+				ptr[2] = cell_data->cell.coord_y;
+				ptr[3] = cell_data->cell.alternative_tile;
+			} else {
+				ptr[0] = TileSet::INVALID_SOURCE;
+				ptr[1] = TileSetSource::INVALID_ATLAS_COORDS.x;
+				ptr[2] = TileSetSource::INVALID_ATLAS_COORDS.y;
+				ptr[3] = TileSetSource::INVALID_TILE_ALTERNATIVE;
+			}
+			ptr += 4;
+		}
+	}
+	return cells;
+}
+
 void TileMapLayer::fix_invalid_tiles() {
 	ERR_FAIL_COND_MSG(tile_set.is_null(), "Cannot call fix_invalid_tiles() on a TileMapLayer without a valid TileSet.");
 
@@ -2462,7 +2980,7 @@ void TileMapLayer::clear() {
 
 int TileMapLayer::get_cell_source_id(const Vector2i &p_coords) const {
 	// Get a cell source id from position.
-	HashMap<Vector2i, CellData>::ConstIterator E = tile_map_layer_data.find(p_coords);
+	CellDataMap::ConstIterator E = tile_map_layer_data.find(p_coords);
 
 	if (!E) {
 		return TileSet::INVALID_SOURCE;
@@ -2473,7 +2991,7 @@ int TileMapLayer::get_cell_source_id(const Vector2i &p_coords) const {
 
 Vector2i TileMapLayer::get_cell_atlas_coords(const Vector2i &p_coords) const {
 	// Get a cell source id from position.
-	HashMap<Vector2i, CellData>::ConstIterator E = tile_map_layer_data.find(p_coords);
+	CellDataMap::ConstIterator E = tile_map_layer_data.find(p_coords);
 
 	if (!E) {
 		return TileSetSource::INVALID_ATLAS_COORDS;
@@ -2484,7 +3002,7 @@ Vector2i TileMapLayer::get_cell_atlas_coords(const Vector2i &p_coords) const {
 
 int TileMapLayer::get_cell_alternative_tile(const Vector2i &p_coords) const {
 	// Get a cell source id from position.
-	HashMap<Vector2i, CellData>::ConstIterator E = tile_map_layer_data.find(p_coords);
+	CellDataMap::ConstIterator E = tile_map_layer_data.find(p_coords);
 
 	if (!E) {
 		return TileSetSource::INVALID_TILE_ALTERNATIVE;
@@ -2736,7 +3254,7 @@ Vector2i TileMapLayer::get_coords_for_body_rid(RID p_physics_body) const {
 #endif // !_PHYSICS_DISABLED
 
 void TileMapLayer::update_internals() {
-	_internal_update(false);
+	_internal_update(false, true);
 }
 
 void TileMapLayer::notify_runtime_tile_data_update() {
@@ -2994,6 +3512,29 @@ int TileMapLayer::get_rendering_quadrant_size() const {
 	return rendering_quadrant_size;
 }
 
+void TileMapLayer::set_rendering_quadrant_baked(bool p_baked) {
+	if (rendering_quadrant_baked == p_baked) {
+		return;
+	}
+	rendering_quadrant_baked = p_baked;
+	dirty.flags[DIRTY_FLAGS_LAYER_RENDERING_QUADRANT_BAKED] = true;
+	_queue_internal_update();
+	emit_signal(CoreStringName(changed));
+}
+
+bool TileMapLayer::is_rendering_quadrant_baked() const {
+	return rendering_quadrant_baked;
+}
+
+void TileMapLayer::set_rendering_quadrant_updates_per_frame(int p_count) {
+	ERR_FAIL_COND_MSG(p_count < 0, "The number of rendering quadrant updates per frame cannot be negative.");
+	rendering_quadrant_updates_per_frame = p_count;
+}
+
+int TileMapLayer::get_rendering_quadrant_updates_per_frame() const {
+	return rendering_quadrant_updates_per_frame;
+}
+
 void TileMapLayer::set_collision_enabled(bool p_enabled) {
 	if (collision_enabled == p_enabled) {
 		return;
@@ -3022,6 +3563,20 @@ bool TileMapLayer::is_using_kinematic_bodies() const {
 	return use_kinematic_bodies;
 }
 
+void TileMapLayer::set_collision_merged(bool p_collision_merged) {
+	if (collision_merged == p_collision_merged) {
+		return;
+	}
+	collision_merged = p_collision_merged;
+	dirty.flags[DIRTY_FLAGS_LAYER_COLLISION_MERGED] = true;
+	_queue_internal_update();
+	emit_signal(CoreStringName(changed));
+}
+
+bool TileMapLayer::is_collision_merged() const {
+	return collision_merged;
+}
+
 void TileMapLayer::set_collision_visibility_mode(TileMapLayer::DebugVisibilityMode p_show_collision) {
 	if (collision_visibility_mode == p_show_collision) {
 		return;
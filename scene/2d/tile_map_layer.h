@@ -102,8 +102,10 @@ struct CellData {
 	Vector2i coords;
 	TileMapCell cell;
 
+#ifdef DEBUG_ENABLED
 	// Debug.
 	SelfList<CellData> debug_quadrant_list_element;
+#endif // DEBUG_ENABLED
 
 	// Rendering.
 	Ref<RenderingQuadrant> rendering_quadrant;
@@ -149,7 +151,9 @@ struct CellData {
 	}
 
 	CellData(const CellData &p_other) :
+#ifdef DEBUG_ENABLED
 			debug_quadrant_list_element(this),
+#endif // DEBUG_ENABLED
 			rendering_quadrant_list_element(this),
 			dirty_list_element(this) {
 		coords = p_other.coords;
@@ -166,12 +170,281 @@ struct CellData {
 	}
 
 	CellData() :
+#ifdef DEBUG_ENABLED
 			debug_quadrant_list_element(this),
+#endif // DEBUG_ENABLED
 			rendering_quadrant_list_element(this),
 			dirty_list_element(this) {
 	}
 };
 
+// Stores the cells of a layer in chunks of CHUNK_SIZE x CHUNK_SIZE cells. Each chunk owns the CellData of its
+// cells in a single block, so neighboring cells are close in memory and iterating does not go through one
+// allocation per cell. Cells never move once inserted, as the quadrants and dirty lists point to them.
+// The API follows the part of HashMap<Vector2i, CellData> used by TileMapLayer.
+class CellDataMap {
+public:
+	static constexpr int CHUNK_SHIFT = 3;
+	static constexpr int CHUNK_SIZE = 1 << CHUNK_SHIFT;
+	static constexpr int CHUNK_MASK = CHUNK_SIZE - 1;
+	static constexpr int CHUNK_CELL_COUNT = CHUNK_SIZE * CHUNK_SIZE;
+
+private:
+	typedef KeyValue<Vector2i, CellData> Element;
+
+	struct Chunk {
+		// One bit per slot, set when the slot holds a cell.
+		uint64_t used = 0;
+		alignas(Element) uint8_t slots[CHUNK_CELL_COUNT * sizeof(Element)];
+
+		_FORCE_INLINE_ Element *get_slot(int p_index) {
+			return reinterpret_cast<Element *>(slots) + p_index;
+		}
+		_FORCE_INLINE_ const Element *get_slot(int p_index) const {
+			return reinterpret_cast<const Element *>(slots) + p_index;
+		}
+	};
+	static_assert(CHUNK_CELL_COUNT == 64, "Chunk slots are tracked in a 64-bit mask.");
+
+	HashMap<Vector2i, Chunk *> chunks;
+	uint32_t cell_count = 0;
+
+	static _FORCE_INLINE_ Vector2i _get_chunk_coords(const Vector2i &p_coords) {
+		return Vector2i(p_coords.x >> CHUNK_SHIFT, p_coords.y >> CHUNK_SHIFT);
+	}
+
+	static _FORCE_INLINE_ int _get_slot_index(const Vector2i &p_coords) {
+		return ((p_coords.y & CHUNK_MASK) << CHUNK_SHIFT) | (p_coords.x & CHUNK_MASK);
+	}
+
+	// Returns the first used slot at or after p_from, or -1 if there is none.
+	static _FORCE_INLINE_ int _find_used_slot(uint64_t p_used, int p_from) {
+		if (p_from >= CHUNK_CELL_COUNT) {
+			return -1;
+		}
+		uint64_t remaining = p_used & (~uint64_t(0) << p_from);
+		if (!remaining) {
+			return -1;
+		}
+#if defined(__GNUC__)
+		return __builtin_ctzll(remaining);
+#else
+		int index = 0;
+		while (!(remaining & 1)) {
+			remaining >>= 1;
+			index++;
+		}
+		return index;
+#endif
+	}
+
+public:
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<Vector2i, CellData> &operator*() const {
+			return *chunk->value->get_slot(slot);
+		}
+		_FORCE_INLINE_ const KeyValue<Vector2i, CellData> *operator->() const { return chunk->value->get_slot(slot); }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			slot++;
+			_skip_unused();
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return chunk == b.chunk && slot == b.slot; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return chunk != b.chunk || slot != b.slot; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return bool(chunk);
+		}
+
+		_FORCE_INLINE_ ConstIterator(HashMap<Vector2i, Chunk *>::ConstIterator p_chunk, int p_slot) :
+				chunk(p_chunk),
+				slot(p_slot) {
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		friend class CellDataMap;
+
+		HashMap<Vector2i, Chunk *>::ConstIterator chunk;
+		int slot = -1;
+
+		// Moves to the first used slot from the current one, going through the next chunks if needed.
+		_FORCE_INLINE_ void _skip_unused() {
+			while (chunk) {
+				slot = _find_used_slot(chunk->value->used, slot);
+				if (slot >= 0) {
+					return;
+				}
+				++chunk;
+				slot = 0;
+			}
+			slot = -1;
+		}
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<Vector2i, CellData> &operator*() const {
+			return *chunk->value->get_slot(slot);
+		}
+		_FORCE_INLINE_ KeyValue<Vector2i, CellData> *operator->() const { return chunk->value->get_slot(slot); }
+		_FORCE_INLINE_ Iterator &operator++() {
+			slot++;
+			_skip_unused();
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return chunk == b.chunk && slot == b.slot; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return chunk != b.chunk || slot != b.slot; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return bool(chunk);
+		}
+
+		_FORCE_INLINE_ Iterator(HashMap<Vector2i, Chunk *>::Iterator p_chunk, int p_slot) :
+				chunk(p_chunk),
+				slot(p_slot) {
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(chunk, slot);
+		}
+
+	private:
+		friend class CellDataMap;
+
+		HashMap<Vector2i, Chunk *>::Iterator chunk;
+		int slot = -1;
+
+		// Moves to the first used slot from the current one, going through the next chunks if needed.
+		_FORCE_INLINE_ void _skip_unused() {
+			while (chunk) {
+				slot = _find_used_slot(chunk->value->used, slot);
+				if (slot >= 0) {
+					return;
+				}
+				++chunk;
+				slot = 0;
+			}
+			slot = -1;
+		}
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		Iterator it(chunks.begin(), 0);
+		it._skip_unused();
+		return it;
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(chunks.end(), -1);
+	}
+	_FORCE_INLINE_ ConstIterator begin() const {
+		ConstIterator it(chunks.begin(), 0);
+		it._skip_unused();
+		return it;
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(chunks.end(), -1);
+	}
+
+	Iterator find(const Vector2i &p_coords) {
+		HashMap<Vector2i, Chunk *>::Iterator chunk = chunks.find(_get_chunk_coords(p_coords));
+		if (!chunk) {
+			return end();
+		}
+		int slot = _get_slot_index(p_coords);
+		if (!(chunk->value->used & (uint64_t(1) << slot))) {
+			return end();
+		}
+		return Iterator(chunk, slot);
+	}
+
+	ConstIterator find(const Vector2i &p_coords) const {
+		HashMap<Vector2i, Chunk *>::ConstIterator chunk = chunks.find(_get_chunk_coords(p_coords));
+		if (!chunk) {
+			return end();
+		}
+		int slot = _get_slot_index(p_coords);
+		if (!(chunk->value->used & (uint64_t(1) << slot))) {
+			return end();
+		}
+		return ConstIterator(chunk, slot);
+	}
+
+	_FORCE_INLINE_ CellData *getptr(const Vector2i &p_coords) {
+		Iterator E = find(p_coords);
+		return E ? &E->value : nullptr;
+	}
+
+	_FORCE_INLINE_ const CellData *getptr(const Vector2i &p_coords) const {
+		ConstIterator E = find(p_coords);
+		return E ? &E->value : nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const Vector2i &p_coords) const {
+		return bool(find(p_coords));
+	}
+
+	// Like HashMap::insert(), overwrites the value if the cell exists.
+	Iterator insert(const Vector2i &p_coords, const CellData &p_value) {
+		const Vector2i chunk_coords = _get_chunk_coords(p_coords);
+		HashMap<Vector2i, Chunk *>::Iterator chunk = chunks.find(chunk_coords);
+		if (!chunk) {
+			chunk = chunks.insert(chunk_coords, memnew(Chunk));
+		}
+		int slot = _get_slot_index(p_coords);
+		const uint64_t bit = uint64_t(1) << slot;
+		if (chunk->value->used & bit) {
+			chunk->value->get_slot(slot)->value = p_value;
+		} else {
+			memnew_placement(chunk->value->get_slot(slot), Element(p_coords, p_value));
+			chunk->value->used |= bit;
+			cell_count++;
+		}
+		return Iterator(chunk, slot);
+	}
+
+	bool erase(const Vector2i &p_coords) {
+		Iterator E = find(p_coords);
+		if (!E) {
+			return false;
+		}
+		Chunk *chunk = E.chunk->value;
+		chunk->get_slot(E.slot)->~Element();
+		chunk->used &= ~(uint64_t(1) << E.slot);
+		cell_count--;
+		if (!chunk->used) {
+			chunks.remove(E.chunk);
+			memdelete(chunk);
+		}
+		return true;
+	}
+
+	void clear() {
+		for (KeyValue<Vector2i, Chunk *> &E : chunks) {
+			Chunk *chunk = E.value;
+			for (int slot = _find_used_slot(chunk->used, 0); slot >= 0; slot = _find_used_slot(chunk->used, slot + 1)) {
+				chunk->get_slot(slot)->~Element();
+			}
+			memdelete(chunk);
+		}
+		chunks.clear();
+		cell_count = 0;
+	}
+
+	_FORCE_INLINE_ uint32_t size() const { return cell_count; }
+	_FORCE_INLINE_ bool is_empty() const { return cell_count == 0; }
+	_FORCE_INLINE_ uint32_t get_chunk_count() const { return chunks.size(); }
+
+	CellDataMap() {}
+	CellDataMap(const CellDataMap &p_other) = delete;
+	void operator=(const CellDataMap &p_other) = delete;
+	~CellDataMap() {
+		clear();
+	}
+};
+
 // We use another comparator for Y-sorted layers with reversed X drawing order.
 struct CellDataYSortedXReversedComparator {
 	_FORCE_INLINE_ bool operator()(const CellData &p_a, const CellData &p_b) const {
@@ -263,8 +536,10 @@ public:
 		DIRTY_FLAGS_LAYER_TEXTURE_FILTER,
 		DIRTY_FLAGS_LAYER_TEXTURE_REPEAT,
 		DIRTY_FLAGS_LAYER_RENDERING_QUADRANT_SIZE,
+		DIRTY_FLAGS_LAYER_RENDERING_QUADRANT_BAKED,
 		DIRTY_FLAGS_LAYER_COLLISION_ENABLED,
 		DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES,
+		DIRTY_FLAGS_LAYER_COLLISION_MERGED,
 		DIRTY_FLAGS_LAYER_COLLISION_VISIBILITY_MODE,
 		DIRTY_FLAGS_LAYER_OCCLUSION_ENABLED,
 		DIRTY_FLAGS_LAYER_NAVIGATION_ENABLED,
@@ -286,7 +561,7 @@ private:
 	static constexpr float FP_ADJUST = 0.00001;
 
 	// Properties.
-	HashMap<Vector2i, CellData> tile_map_layer_data;
+	CellDataMap tile_map_layer_data;
 
 	bool enabled = true;
 	Ref<TileSet> tile_set;
@@ -296,9 +571,12 @@ private:
 	int y_sort_origin = 0;
 	bool x_draw_order_reversed = false;
 	int rendering_quadrant_size = 16;
+	bool rendering_quadrant_baked = false;
+	int rendering_quadrant_updates_per_frame = 0;
 
 	bool collision_enabled = true;
 	bool use_kinematic_bodies = false;
+	bool collision_merged = false;
 	DebugVisibilityMode collision_visibility_mode = DEBUG_VISIBILITY_MODE_DEFAULT;
 
 	bool occlusion_enabled = true;
@@ -336,6 +614,7 @@ private:
 	void _clear_runtime_update_tile_data();
 	void _clear_runtime_update_tile_data_for_cell(CellData &r_cell_data);
 	void _update_cells_callback(bool p_force_cleanup);
+	bool _uses_runtime_tile_data_update() const;
 
 	// Per-system methods.
 #ifdef DEBUG_ENABLED
@@ -347,12 +626,58 @@ private:
 #endif // DEBUG_ENABLED
 
 	HashMap<Vector2i, Ref<RenderingQuadrant>> rendering_quadrant_map;
+	SelfList<RenderingQuadrant>::List rendering_dirty_quadrant_list; // May outlive an update when the rebuild budget is exceeded.
 	bool _rendering_was_cleaned_up = false;
-	void _rendering_update(bool p_force_cleanup);
+	void _rendering_update(bool p_force_cleanup, bool p_ignore_budget);
 	void _rendering_notification(int p_what);
 	void _rendering_quadrants_update_cell(CellData &r_cell_data, SelfList<RenderingQuadrant>::List &r_dirty_rendering_quadrant_list);
 	void _rendering_occluders_clear_cell(CellData &r_cell_data);
 	void _rendering_occluders_update_cell(CellData &r_cell_data);
+
+	// Texture of an atlas source whose tiles can be baked. Getting the RID of a texture may create it,
+	// so they are resolved on the main thread before quadrants are built.
+	struct RenderingBakeTexture {
+		RID rid;
+		Vector2 size;
+	};
+	HashMap<int, RenderingBakeTexture> rendering_bake_textures; // By source ID.
+	void _rendering_resolve_bake_textures();
+
+	// Consecutive static tiles sharing a texture, merged into a single triangle array.
+	struct RenderingBakedRun {
+		RID texture;
+		LocalVector<Vector2> points;
+		LocalVector<Vector2> uvs;
+		LocalVector<Color> colors;
+		LocalVector<int> indices;
+	};
+	// A tile drawn with draw_tile(), or a baked run when baked_run is set.
+	struct RenderingTileDraw {
+		const CellData *cell_data = nullptr;
+		const TileData *tile_data = nullptr;
+		Vector2 position;
+		real_t animation_offset = 0.0;
+		int baked_run = -1;
+	};
+	struct RenderingCanvasItemBuild {
+		Ref<Material> material;
+		int z_index = 0;
+		LocalVector<RenderingTileDraw> draws;
+		LocalVector<RenderingBakedRun> baked_runs;
+	};
+	// Quadrants are built on worker threads, then committed to the RenderingServer on the main thread.
+	// Node state is read on the main thread beforehand, as its getters are not available to worker threads.
+	struct RenderingQuadrantBuild {
+		RenderingQuadrant *quadrant = nullptr;
+		bool sort_x_reversed = false;
+		Color self_modulate;
+		LocalVector<RenderingCanvasItemBuild> canvas_items;
+	};
+	static constexpr uint32_t RENDERING_QUADRANT_THREADED_BUILD_MIN = 2;
+	void _rendering_build_quadrant(RenderingQuadrantBuild &r_build) const;
+	void _rendering_build_quadrant_task(uint32_t p_index, RenderingQuadrantBuild *p_builds);
+	void _rendering_commit_quadrant(RenderingQuadrantBuild &r_build, bool p_set_not_interpolated);
+	bool _rendering_bake_tile(RenderingCanvasItemBuild &r_canvas_item, const Vector2 &p_position, const Color &p_self_modulate, const RenderingBakeTexture &p_texture, TileSetAtlasSource *p_atlas_source, const Vector2i &p_atlas_coords, int p_alternative_tile, const TileData *p_tile_data) const;
 #ifdef DEBUG_ENABLED
 	void _rendering_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
@@ -362,7 +687,29 @@ private:
 	void _physics_update(bool p_force_cleanup);
 	void _physics_notification(int p_what);
 	void _physics_clear_cell(CellData &r_cell_data);
-	void _physics_update_cell(CellData &r_cell_data);
+	void _physics_update_cell(CellData &r_cell_data, bool p_merge_collisions);
+
+	// Static collision of a block of cells, merged into one body per TileSet physics layer.
+	struct PhysicsMergedQuadrant {
+		LocalVector<RID> bodies;
+		LocalVector<RID> shapes;
+	};
+	HashMap<Vector2i, PhysicsMergedQuadrant> physics_merged_quadrant_map;
+	bool _physics_was_merging_collisions = false;
+	Vector2i _coords_to_physics_merged_quadrant_coords(const Vector2i &p_coords) const;
+	bool _physics_is_tile_mergeable(const TileData *p_tile_data, int p_physics_layer) const;
+	void _physics_clear_merged_quadrant(PhysicsMergedQuadrant &r_quadrant);
+	void _physics_clear_merged_quadrants();
+
+	// The merged shapes of a quadrant are computed on worker threads, then given to the PhysicsServer2D on the main thread.
+	struct PhysicsMergedQuadrantBuild {
+		Vector2i quadrant_coords;
+		LocalVector<LocalVector<Vector<Vector2>>> convex_polygons; // Per TileSet physics layer.
+	};
+	static constexpr uint32_t PHYSICS_MERGED_QUADRANT_THREADED_BUILD_MIN = 2;
+	void _physics_build_merged_quadrant(PhysicsMergedQuadrantBuild &r_build) const;
+	void _physics_build_merged_quadrant_task(uint32_t p_index, PhysicsMergedQuadrantBuild *p_builds);
+	void _physics_commit_merged_quadrant(const PhysicsMergedQuadrantBuild &p_build);
 #ifdef DEBUG_ENABLED
 	void _physics_draw_cell_debug(const RID &p_canvas_item, const Vector2 &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
@@ -400,7 +747,7 @@ private:
 	// Internal updates.
 	void _queue_internal_update();
 	void _deferred_internal_update();
-	void _internal_update(bool p_force_cleanup);
+	void _internal_update(bool p_force_cleanup, bool p_ignore_budget = false);
 
 	virtual void _physics_interpolated_changed() override;
 
@@ -423,7 +770,7 @@ public:
 	int get_index_in_tile_map() const {
 		return layer_index_in_tile_map_node;
 	}
-	const HashMap<Vector2i, CellData> &get_tile_map_layer_data() const {
+	const CellDataMap &get_tile_map_layer_data() const {
 		return tile_map_layer_data;
 	}
 
@@ -447,6 +794,8 @@ public:
 	// Generic cells manipulations and data access.
 	void set_cell(const Vector2i &p_coords, int p_source_id = TileSet::INVALID_SOURCE, const Vector2i &p_atlas_coords = TileSetSource::INVALID_ATLAS_COORDS, int p_alternative_tile = 0);
 	void erase_cell(const Vector2i &p_coords);
+	void set_cells_in_rect(const Rect2i &p_rect, const PackedInt32Array &p_cells);
+	PackedInt32Array get_cells_in_rect(const Rect2i &p_rect) const;
 	void fix_invalid_tiles();
 	void clear();
 
@@ -512,11 +861,17 @@ public:
 	virtual void set_light_mask(int p_light_mask) override;
 	void set_rendering_quadrant_size(int p_size);
 	int get_rendering_quadrant_size() const;
+	void set_rendering_quadrant_baked(bool p_baked);
+	bool is_rendering_quadrant_baked() const;
+	void set_rendering_quadrant_updates_per_frame(int p_count);
+	int get_rendering_quadrant_updates_per_frame() const;
 
 	void set_collision_enabled(bool p_enabled);
 	bool is_collision_enabled() const;
 	void set_use_kinematic_bodies(bool p_use_kinematic_bodies);
 	bool is_using_kinematic_bodies() const;
+	void set_collision_merged(bool p_collision_merged);
+	bool is_collision_merged() const;
 	void set_collision_visibility_mode(DebugVisibilityMode p_show_collision);
 	DebugVisibilityMode get_collision_visibility_mode() const;
 
@@ -34,6 +34,7 @@
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/string/string_name.h"
+#include "core/templates/frame_allocator.h"
 #ifndef _PHYSICS_DISABLED
 #include "scene/2d/audio_stream_player_2d.h"
 #endif // !_PHYSICS_DISABLED
@@ -1956,11 +1957,13 @@ void AnimationMixer::_blend_apply() {
 				TrackCacheAudio *t = static_cast<TrackCacheAudio *>(track);
 
 				// Audio ending process.
-				LocalVector<ObjectID> erase_maps;
+				// The erase lists only live until the audio tracks are processed.
+				FrameAllocator::Scope frame_scope;
+				FrameVector<ObjectID> erase_maps;
 				for (KeyValue<ObjectID, PlayingAudioTrackInfo> &L : t->playing_streams) {
 					PlayingAudioTrackInfo &track_info = L.value;
 					float db = Math::linear_to_db(track_info.use_blend ? track_info.volume : 1.0);
-					LocalVector<int> erase_streams;
+					FrameVector<int> erase_streams;
 					AHashMap<int, PlayingAudioStreamInfo> &map = track_info.stream_info;
 					for (const KeyValue<int, PlayingAudioStreamInfo> &M : map) {
 						PlayingAudioStreamInfo pasi = M.value;
@@ -30,6 +30,7 @@
 
 #include "box_container.h"
 
+#include "core/templates/inline_vector.h"
 #include "scene/gui/label.h"
 #include "scene/gui/margin_container.h"
 #include "scene/theme/theme_db.h"
@@ -52,7 +53,9 @@ void BoxContainer::_resort() {
 	int stretch_min = 0;
 	int stretch_avail = 0;
 	float stretch_ratio_total = 0.0;
-	HashMap<Control *, _MinSizeCache> min_size_cache;
+	// Indexed by child index.
+	InlineVector<_MinSizeCache, 32> min_size_cache;
+	min_size_cache.resize(get_child_count());
 
 	for (int i = 0; i < get_child_count(); i++) {
 		Control *c = as_sortable_control(get_child(i));
@@ -79,7 +82,7 @@ void BoxContainer::_resort() {
 			stretch_ratio_total += c->get_stretch_ratio();
 		}
 		msc.final_size = msc.min_size;
-		min_size_cache[c] = msc;
+		min_size_cache[i] = msc;
 		children_count++;
 	}
 
@@ -111,8 +114,7 @@ void BoxContainer::_resort() {
 				continue;
 			}
 
-			ERR_FAIL_COND(!min_size_cache.has(c));
-			_MinSizeCache &msc = min_size_cache[c];
+			_MinSizeCache &msc = min_size_cache[i];
 
 			if (msc.will_stretch) { //wants to stretch
 				//let's see if it can really stretch
@@ -200,7 +202,7 @@ void BoxContainer::_resort() {
 			continue;
 		}
 
-		_MinSizeCache &msc = min_size_cache[c];
+		_MinSizeCache &msc = min_size_cache[i];
 
 		if (first) {
 			first = false;
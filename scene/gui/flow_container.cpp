@@ -30,6 +30,7 @@
 
 #include "flow_container.h"
 
+#include "core/templates/inline_vector.h"
 #include "scene/gui/texture_rect.h"
 #include "scene/theme/theme_db.h"
 
@@ -50,9 +51,11 @@ void FlowContainer::_resort() {
 
 	bool rtl = is_layout_rtl();
 
-	HashMap<Control *, Size2i> children_minsize_cache;
+	// Indexed by child index.
+	InlineVector<Size2i, 32> children_minsize_cache;
+	children_minsize_cache.resize(get_child_count());
 
-	Vector<_LineData> lines_data;
+	InlineVector<_LineData, 8> lines_data;
 
 	Vector2i ofs;
 	int line_height = 0;
@@ -117,7 +120,7 @@ void FlowContainer::_resort() {
 		}
 
 		last_child = child;
-		children_minsize_cache[child] = child_msc;
+		children_minsize_cache[i] = child_msc;
 		children_in_current_line++;
 	}
 	line_length = vertical ? (ofs.y) : (ofs.x);
@@ -140,7 +143,7 @@ void FlowContainer::_resort() {
 		if (!child) {
 			continue;
 		}
-		Size2i child_size = children_minsize_cache[child];
+		Size2i child_size = children_minsize_cache[i];
 
 		_LineData line_data = lines_data[current_line_idx];
 		if (child_idx_in_line >= lines_data[current_line_idx].child_count) {
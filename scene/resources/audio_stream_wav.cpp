@@ -595,6 +595,10 @@ Vector<uint8_t> AudioStreamWAV::get_data() const {
 	return pv;
 }
 
+uint64_t AudioStreamWAV::get_memory_usage() const {
+	return data.size();
+}
+
 Error AudioStreamWAV::save_to_wav(const String &p_path) {
 	if (format == AudioStreamWAV::FORMAT_IMA_ADPCM || format == AudioStreamWAV::FORMAT_QOA) {
 		WARN_PRINT("Saving IMA_ADPCM and QOA samples is not supported yet");
@@ -169,6 +169,8 @@ public:
 	void set_data(const Vector<uint8_t> &p_data);
 	Vector<uint8_t> get_data() const;
 
+	virtual uint64_t get_memory_usage() const override;
+
 	Error save_to_wav(const String &p_path);
 
 	virtual Ref<AudioStreamPlayback> instantiate_playback() override;
@@ -211,6 +211,14 @@ RID CompressedTexture2D::get_rid() const {
 	return texture;
 }
 
+uint64_t CompressedTexture2D::get_memory_usage() const {
+	if ((w | h) == 0) {
+		return 0;
+	}
+	// Mipmaps aren't tracked after loading, assume they're there as it's the common case.
+	return Image::get_image_data_size(w, h, format, true);
+}
+
 void CompressedTexture2D::draw(RID p_canvas_item, const Point2 &p_pos, const Color &p_modulate, bool p_transpose) const {
 	if ((w | h) == 0) {
 		return;
@@ -148,6 +148,13 @@ RID ImageTexture::get_rid() const {
 	return texture;
 }
 
+uint64_t ImageTexture::get_memory_usage() const {
+	if (texture.is_null()) {
+		return 0;
+	}
+	return Image::get_image_data_size(w, h, format, mipmaps);
+}
+
 bool ImageTexture::has_alpha() const {
 	return (format == Image::FORMAT_LA8 || format == Image::FORMAT_RGBA8);
 }
@@ -1994,6 +1994,22 @@ RID ArrayMesh::get_rid() const {
 	return mesh;
 }
 
+uint64_t ArrayMesh::get_memory_usage() const {
+	uint64_t total = 0;
+	for (const Surface &surface : surfaces) {
+		uint32_t offsets[RS::ARRAY_MAX];
+		uint32_t vertex_stride = 0;
+		uint32_t normal_tangent_stride = 0;
+		uint32_t attribute_stride = 0;
+		uint32_t skin_stride = 0;
+		RS::get_singleton()->mesh_surface_make_offsets_from_format(surface.format & ~RS::ARRAY_FORMAT_INDEX, surface.array_length, 0, offsets, vertex_stride, normal_tangent_stride, attribute_stride, skin_stride);
+		total += uint64_t(vertex_stride + normal_tangent_stride + attribute_stride + skin_stride) * surface.array_length;
+		// Same rule as the one used to create the index buffer.
+		total += uint64_t(surface.index_array_length) * ((surface.array_length <= (1 << 16) && surface.array_length > 0) ? 2 : 4);
+	}
+	return total;
+}
+
 AABB ArrayMesh::get_aabb() const {
 	return aabb;
 }
@@ -384,6 +384,7 @@ public:
 
 	AABB get_aabb() const override;
 	virtual RID get_rid() const override;
+	virtual uint64_t get_memory_usage() const override;
 
 	void regen_normal_maps();
 
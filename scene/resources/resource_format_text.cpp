@@ -866,7 +866,7 @@ void ResourceLoaderText::set_translation_remapped(bool p_remapped) {
 }
 
 ResourceLoaderText::ResourceLoaderText() :
-		stream(false), format_version(FORMAT_VERSION) {}
+		format_version(FORMAT_VERSION) {}
 
 void ResourceLoaderText::get_dependencies(Ref<FileAccess> p_f, List<String> *p_dependencies, bool p_add_types) {
 	open(p_f);
@@ -943,7 +943,7 @@ Error ResourceLoaderText::rename_dependencies(Ref<FileAccess> p_f, const String
 
 	String base_path = local_path.get_base_dir();
 
-	uint64_t tag_end = f->get_position();
+	uint64_t tag_end = stream.get_position();
 
 	while (true) {
 		Error err = VariantParser::parse_tag(&stream, lines, error_text, next_tag, &rp);
@@ -1026,7 +1026,7 @@ Error ResourceLoaderText::rename_dependencies(Ref<FileAccess> p_f, const String
 			s += " path=\"" + path + "\" id=\"" + id + "\"]";
 			fw->store_line(s); // Bundled.
 
-			tag_end = f->get_position();
+			tag_end = stream.get_position();
 		}
 	}
 
@@ -1069,7 +1069,7 @@ void ResourceLoaderText::open(Ref<FileAccess> p_f, bool p_skip_first_tag) {
 	lines = 1;
 	f = p_f;
 
-	stream.f = f;
+	stream.set_data(f->get_buffer(f->get_length() - f->get_position()));
 	is_scene = false;
 	ignore_resource_parsing = false;
 	resource_current = 0;
@@ -1272,12 +1272,14 @@ String ResourceLoaderText::recognize_script_class(Ref<FileAccess> p_f) {
 	lines = 1;
 	f = p_f;
 
-	stream.f = f;
+	// Only the first tag is needed, don't read the whole file.
+	VariantParser::StreamFile header_stream;
+	header_stream.f = f;
 
 	ignore_resource_parsing = true;
 
 	VariantParser::Tag tag;
-	Error err = VariantParser::parse_tag(&stream, lines, error_text, tag);
+	Error err = VariantParser::parse_tag(&header_stream, lines, error_text, tag);
 
 	if (err) {
 		_printerr();
@@ -1310,12 +1312,14 @@ String ResourceLoaderText::recognize(Ref<FileAccess> p_f) {
 	lines = 1;
 	f = p_f;
 
-	stream.f = f;
+	// Only the first tag is needed, don't read the whole file.
+	VariantParser::StreamFile header_stream;
+	header_stream.f = f;
 
 	ignore_resource_parsing = true;
 
 	VariantParser::Tag tag;
-	Error err = VariantParser::parse_tag(&stream, lines, error_text, tag);
+	Error err = VariantParser::parse_tag(&header_stream, lines, error_text, tag);
 
 	if (err) {
 		_printerr();
@@ -1354,12 +1358,14 @@ ResourceUID::ID ResourceLoaderText::get_uid(Ref<FileAccess> p_f) {
 	lines = 1;
 	f = p_f;
 
-	stream.f = f;
+	// Only the first tag is needed, don't read the whole file.
+	VariantParser::StreamFile header_stream;
+	header_stream.f = f;
 
 	ignore_resource_parsing = true;
 
 	VariantParser::Tag tag;
-	Error err = VariantParser::parse_tag(&stream, lines, error_text, tag);
+	Error err = VariantParser::parse_tag(&header_stream, lines, error_text, tag);
 
 	if (err) {
 		_printerr();
@@ -2104,6 +2110,7 @@ Error ResourceLoaderText::set_uid(Ref<FileAccess> p_f, ResourceUID::ID p_uid) {
 		fw->store_string("[gd_resource type=\"" + res_type + "\" " + script_res_text + "load_steps=" + itos(resources_total) + " format=" + itos(format_version) + " uid=\"" + ResourceUID::get_singleton()->id_to_text(p_uid) + "\"]");
 	}
 
+	f->seek(stream.get_position());
 	uint8_t c = f->get_8();
 	while (!f->eof_reached()) {
 		fw->store_8(c);
@@ -56,7 +56,8 @@ private:
 
 	Ref<FileAccess> f;
 
-	VariantParser::StreamFile stream;
+	// The whole file is read in memory when opened, parsing it is much faster than going through FileAccess for every character.
+	VariantParser::StreamBuffer stream;
 
 	struct ExtResource {
 		Ref<ResourceLoader::LoadToken> load_token;
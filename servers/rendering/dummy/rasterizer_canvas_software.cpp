@@ -0,0 +1,513 @@
+/**************************************************************************/
+/*  rasterizer_canvas_software.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "rasterizer_canvas_software.h"
+
+#include "core/object/worker_thread_pool.h"
+#include "servers/rendering/dummy/storage/texture_storage.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+RendererCanvasRender::PolygonID RasterizerCanvasSoftware::request_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights) {
+	ERR_FAIL_COND_V(p_points.is_empty(), 0);
+
+	PolygonData pd;
+	for (int index : p_indices) {
+		ERR_FAIL_INDEX_V(index, p_points.size(), 0);
+		pd.indices.push_back(index);
+	}
+	for (const Point2 &point : p_points) {
+		pd.points.push_back(point);
+	}
+	for (const Color &color : p_colors) {
+		pd.colors.push_back(color);
+	}
+	if (p_uvs.size() == p_points.size()) {
+		for (const Point2 &uv : p_uvs) {
+			pd.uvs.push_back(uv);
+		}
+	}
+
+	PolygonID id = ++last_polygon_id;
+	polygons.insert(id, pd);
+	return id;
+}
+
+void RasterizerCanvasSoftware::free_polygon(PolygonID p_polygon) {
+	polygons.erase(p_polygon);
+}
+
+int32_t RasterizerCanvasSoftware::_get_texture(RID p_texture, Size2 &r_size) {
+	if (p_texture.is_null()) {
+		return -1;
+	}
+
+	const int32_t *index = texture_indices.getptr(p_texture);
+	if (!index) {
+		SourceTexture texture;
+		texture.data = RendererDummy::TextureStorage::get_singleton()->texture_get_software_data(p_texture, texture.size);
+		int32_t new_index = -1;
+		if (texture.data && texture.size.width > 0 && texture.size.height > 0) {
+			new_index = textures.size();
+			textures.push_back(texture);
+		}
+		index = &texture_indices.insert(p_texture, new_index)->value;
+	}
+
+	if (*index >= 0) {
+		r_size = textures[*index].size;
+	}
+	return *index;
+}
+
+void RasterizerCanvasSoftware::_add_triangle(const Vector2 *p_points, const Vector2 *p_uvs, const Color *p_colors, const Transform2D &p_xform, const Rect2i &p_clip, int32_t p_texture, bool p_filter_linear, TextureRepeat p_repeat, const Rect2 &p_uv_clip) {
+	Triangle triangle;
+	Vector2 min;
+	Vector2 max;
+	for (int i = 0; i < 3; i++) {
+		triangle.points[i] = p_xform.xform(p_points[i]);
+		triangle.uvs[i] = p_uvs[i];
+		triangle.colors[i] = p_colors[i];
+		if (i == 0) {
+			min = triangle.points[0];
+			max = triangle.points[0];
+		} else {
+			min = min.min(triangle.points[i]);
+			max = max.max(triangle.points[i]);
+		}
+	}
+
+	if (!min.is_finite() || !max.is_finite()) {
+		return;
+	}
+	const Point2i from = min.floor();
+	const Point2i to = max.ceil();
+	triangle.bounds = Rect2i(from, to - from).intersection(p_clip);
+	if (!triangle.bounds.has_area()) {
+		return;
+	}
+
+	triangle.uv_clip = p_uv_clip;
+	triangle.texture = p_texture;
+	triangle.filter_linear = p_filter_linear;
+	triangle.repeat = p_repeat;
+	triangles.push_back(triangle);
+}
+
+void RasterizerCanvasSoftware::_add_rect(const Rect2 &p_rect, const Rect2 &p_uv_rect, bool p_transpose, const Color &p_color, const Transform2D &p_xform, const Rect2i &p_clip, int32_t p_texture, bool p_filter_linear, TextureRepeat p_repeat, const Rect2 &p_uv_clip) {
+	// Same layout as the vertex shaders of the GPU renderers: a negative UV size flips the
+	// rect on that axis, and transposing swaps the UV axes.
+	static const Vector2 corners[4] = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+
+	Vector2 points[4];
+	Vector2 uvs[4];
+	const Color colors[3] = { p_color, p_color, p_color };
+	for (int i = 0; i < 4; i++) {
+		const Vector2 &corner = corners[i];
+		Vector2 vertex(p_uv_rect.size.x < 0 ? 1.0 - corner.x : corner.x, p_uv_rect.size.y < 0 ? 1.0 - corner.y : corner.y);
+		points[i] = p_rect.position + p_rect.size * vertex;
+		uvs[i] = p_uv_rect.position + p_uv_rect.size.abs() * (p_transpose ? Vector2(corner.y, corner.x) : corner);
+	}
+
+	const Vector2 points_a[3] = { points[0], points[1], points[2] };
+	const Vector2 uvs_a[3] = { uvs[0], uvs[1], uvs[2] };
+	_add_triangle(points_a, uvs_a, colors, p_xform, p_clip, p_texture, p_filter_linear, p_repeat, p_uv_clip);
+	const Vector2 points_b[3] = { points[0], points[2], points[3] };
+	const Vector2 uvs_b[3] = { uvs[0], uvs[2], uvs[3] };
+	_add_triangle(points_b, uvs_b, colors, p_xform, p_clip, p_texture, p_filter_linear, p_repeat, p_uv_clip);
+}
+
+void RasterizerCanvasSoftware::_add_item(const Item *p_item, const Color &p_modulate, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat) {
+	RS::CanvasItemTextureFilter texture_filter = p_item->texture_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT ? p_default_filter : p_item->texture_filter;
+	const bool filter_linear = texture_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST && texture_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST_WITH_MIPMAPS && texture_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST_WITH_MIPMAPS_ANISOTROPIC;
+
+	RS::CanvasItemTextureRepeat texture_repeat = p_item->texture_repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT ? p_default_repeat : p_item->texture_repeat;
+	TextureRepeat repeat = TEXTURE_REPEAT_DISABLED;
+	if (texture_repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED) {
+		repeat = TEXTURE_REPEAT_ENABLED;
+	} else if (texture_repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_MIRROR) {
+		repeat = TEXTURE_REPEAT_MIRROR;
+	}
+
+	const Rect2i target_rect(Point2i(), target_size);
+	Rect2i clip = target_rect;
+	if (p_item->final_clip_owner) {
+		clip = clip.intersection(Rect2i(p_item->final_clip_owner->final_clip_rect));
+	}
+	Rect2i current_clip = clip;
+
+	const Color base_color = p_item->final_modulate * p_modulate;
+	const Transform2D base_transform = p_item->final_transform;
+	Transform2D draw_transform; // Set by transform commands.
+	bool skipping = false;
+
+	for (const Item::Command *c = p_item->commands; c; c = c->next) {
+		if (skipping && c->type != Item::Command::TYPE_ANIMATION_SLICE) {
+			continue;
+		}
+
+		const Transform2D xform = base_transform * draw_transform;
+
+		switch (c->type) {
+			case Item::Command::TYPE_RECT: {
+				const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
+
+				Size2 texture_size;
+				const int32_t texture = _get_texture(rect->texture, texture_size);
+
+				Rect2 uv_rect(0, 0, 1, 1);
+				Rect2 uv_clip;
+				if (texture >= 0) {
+					if (rect->flags & CANVAS_RECT_REGION) {
+						uv_rect = Rect2(rect->source.position / texture_size, rect->source.size / texture_size);
+					}
+					if (rect->flags & CANVAS_RECT_FLIP_H) {
+						uv_rect.size.x *= -1;
+					}
+					if (rect->flags & CANVAS_RECT_FLIP_V) {
+						uv_rect.size.y *= -1;
+					}
+					if (rect->flags & CANVAS_RECT_CLIP_UV) {
+						const Vector2 half_texel = Vector2(0.5, 0.5) / texture_size;
+						uv_clip = Rect2(uv_rect.position + half_texel, uv_rect.size.abs() - half_texel * 2);
+					}
+				}
+
+				const TextureRepeat rect_repeat = (rect->flags & CANVAS_RECT_TILE) ? TEXTURE_REPEAT_ENABLED : repeat;
+				_add_rect(rect->rect.abs(), uv_rect, texture >= 0 && (rect->flags & CANVAS_RECT_TRANSPOSE), rect->modulate * base_color, xform, current_clip, texture, filter_linear, rect_repeat, uv_clip);
+			} break;
+
+			case Item::Command::TYPE_NINEPATCH: {
+				// Tiled axis modes are drawn stretched.
+				const Item::CommandNinePatch *np = static_cast<const Item::CommandNinePatch *>(c);
+
+				Size2 texture_size(1, 1);
+				const int32_t texture = _get_texture(np->texture, texture_size);
+
+				const Rect2 dst = np->rect.abs();
+				Rect2 src = np->source;
+				if (texture < 0 || src == Rect2()) {
+					src = Rect2(Point2(), texture_size);
+				}
+
+				// Margins shrink to fit when the rect is smaller than their sum.
+				real_t margin_scale_x = 1.0;
+				real_t margin_scale_y = 1.0;
+				if (np->margin[SIDE_LEFT] + np->margin[SIDE_RIGHT] > dst.size.x) {
+					margin_scale_x = dst.size.x / MAX(np->margin[SIDE_LEFT] + np->margin[SIDE_RIGHT], (real_t)CMP_EPSILON);
+				}
+				if (np->margin[SIDE_TOP] + np->margin[SIDE_BOTTOM] > dst.size.y) {
+					margin_scale_y = dst.size.y / MAX(np->margin[SIDE_TOP] + np->margin[SIDE_BOTTOM], (real_t)CMP_EPSILON);
+				}
+
+				const real_t dst_x[4] = { dst.position.x, dst.position.x + np->margin[SIDE_LEFT] * margin_scale_x, dst.get_end().x - np->margin[SIDE_RIGHT] * margin_scale_x, dst.get_end().x };
+				const real_t dst_y[4] = { dst.position.y, dst.position.y + np->margin[SIDE_TOP] * margin_scale_y, dst.get_end().y - np->margin[SIDE_BOTTOM] * margin_scale_y, dst.get_end().y };
+				const real_t src_x[4] = { src.position.x, src.position.x + np->margin[SIDE_LEFT], src.get_end().x - np->margin[SIDE_RIGHT], src.get_end().x };
+				const real_t src_y[4] = { src.position.y, src.position.y + np->margin[SIDE_TOP], src.get_end().y - np->margin[SIDE_BOTTOM], src.get_end().y };
+
+				for (int y = 0; y < 3; y++) {
+					for (int x = 0; x < 3; x++) {
+						if (x == 1 && y == 1 && !np->draw_center) {
+							continue;
+						}
+						const Rect2 cell(dst_x[x], dst_y[y], dst_x[x + 1] - dst_x[x], dst_y[y + 1] - dst_y[y]);
+						if (!cell.has_area()) {
+							continue;
+						}
+						const Rect2 uv_cell = Rect2(src_x[x], src_y[y], src_x[x + 1] - src_x[x], src_y[y + 1] - src_y[y]);
+						_add_rect(cell, Rect2(uv_cell.position / texture_size, uv_cell.size / texture_size), false, np->color * base_color, xform, current_clip, texture, filter_linear, repeat);
+					}
+				}
+			} break;
+
+			case Item::Command::TYPE_POLYGON: {
+				// Only triangles are filled, lines and points are not drawn.
+				const Item::CommandPolygon *polygon = static_cast<const Item::CommandPolygon *>(c);
+				if (polygon->primitive != RS::PRIMITIVE_TRIANGLES && polygon->primitive != RS::PRIMITIVE_TRIANGLE_STRIP) {
+					break;
+				}
+				const PolygonData *pd = polygons.getptr(polygon->polygon.polygon_id);
+				if (!pd) {
+					break;
+				}
+
+				Size2 texture_size;
+				const int32_t texture = _get_texture(polygon->texture, texture_size);
+
+				const uint32_t index_count = pd->indices.is_empty() ? pd->points.size() : pd->indices.size();
+				const bool strip = polygon->primitive == RS::PRIMITIVE_TRIANGLE_STRIP;
+				const uint32_t triangle_count = strip ? (index_count >= 3 ? index_count - 2 : 0) : index_count / 3;
+
+				for (uint32_t i = 0; i < triangle_count; i++) {
+					Vector2 points[3];
+					Vector2 uvs[3];
+					Color colors[3];
+					for (int j = 0; j < 3; j++) {
+						const uint32_t k = strip ? i + j : i * 3 + j;
+						const int index = pd->indices.is_empty() ? int(k) : pd->indices[k];
+						points[j] = pd->points[index];
+						if (texture >= 0 && !pd->uvs.is_empty()) {
+							uvs[j] = pd->uvs[index];
+						}
+						if (pd->colors.size() == pd->points.size()) {
+							colors[j] = pd->colors[index] * base_color;
+						} else if (pd->colors.size() == 1) {
+							colors[j] = pd->colors[0] * base_color;
+						} else {
+							colors[j] = base_color;
+						}
+					}
+					_add_triangle(points, uvs, colors, xform, current_clip, texture, filter_linear, repeat);
+				}
+			} break;
+
+			case Item::Command::TYPE_PRIMITIVE: {
+				const Item::CommandPrimitive *primitive = static_cast<const Item::CommandPrimitive *>(c);
+				if (primitive->point_count < 3) {
+					break;
+				}
+
+				Size2 texture_size;
+				const int32_t texture = _get_texture(primitive->texture, texture_size);
+
+				for (uint32_t i = 0; i + 2 < primitive->point_count; i++) {
+					// Quads are fanned out from the first point.
+					const Vector2 points[3] = { primitive->points[0], primitive->points[i + 1], primitive->points[i + 2] };
+					const Vector2 uvs[3] = { primitive->uvs[0], primitive->uvs[i + 1], primitive->uvs[i + 2] };
+					const Color colors[3] = { primitive->colors[0] * base_color, primitive->colors[i + 1] * base_color, primitive->colors[i + 2] * base_color };
+					_add_triangle(points, uvs, colors, xform, current_clip, texture, filter_linear, repeat);
+				}
+			} break;
+
+			case Item::Command::TYPE_TRANSFORM: {
+				const Item::CommandTransform *transform = static_cast<const Item::CommandTransform *>(c);
+				draw_transform = transform->xform;
+			} break;
+
+			case Item::Command::TYPE_CLIP_IGNORE: {
+				const Item::CommandClipIgnore *ci = static_cast<const Item::CommandClipIgnore *>(c);
+				current_clip = ci->ignore ? target_rect : clip;
+			} break;
+
+			case Item::Command::TYPE_ANIMATION_SLICE: {
+				const Item::CommandAnimationSlice *as = static_cast<const Item::CommandAnimationSlice *>(c);
+				double current_time = RSG::rasterizer->get_total_time();
+				double local_time = Math::fposmod(current_time - as->offset, as->animation_length);
+				skipping = !(local_time >= as->slice_begin && local_time < as->slice_end);
+			} break;
+
+			default: {
+				// Meshes, multimeshes and particles are not supported.
+			} break;
+		}
+	}
+}
+
+Color RasterizerCanvasSoftware::_sample(const SourceTexture &p_texture, const Vector2 &p_uv, bool p_filter_linear, TextureRepeat p_repeat) const {
+	const int width = p_texture.size.width;
+	const int height = p_texture.size.height;
+
+	auto wrap = [p_repeat](int p_coord, int p_size) -> int {
+		switch (p_repeat) {
+			case TEXTURE_REPEAT_ENABLED:
+				return Math::posmod(p_coord, p_size);
+			case TEXTURE_REPEAT_MIRROR: {
+				int coord = Math::posmod(p_coord, p_size * 2);
+				return coord < p_size ? coord : p_size * 2 - 1 - coord;
+			}
+			default:
+				return CLAMP(p_coord, 0, p_size - 1);
+		}
+	};
+
+	auto fetch = [&](int p_x, int p_y) -> Color {
+		const uint8_t *texel = p_texture.data + (wrap(p_y, height) * width + wrap(p_x, width)) * 4;
+		return Color(texel[0] / 255.0f, texel[1] / 255.0f, texel[2] / 255.0f, texel[3] / 255.0f);
+	};
+
+	const real_t x = p_uv.x * width;
+	const real_t y = p_uv.y * height;
+	if (!p_filter_linear) {
+		return fetch(Math::floor(x), Math::floor(y));
+	}
+
+	const real_t fx = x - 0.5;
+	const real_t fy = y - 0.5;
+	const int x0 = Math::floor(fx);
+	const int y0 = Math::floor(fy);
+	const float tx = fx - x0;
+	const float ty = fy - y0;
+	const Color top = fetch(x0, y0).lerp(fetch(x0 + 1, y0), tx);
+	const Color bottom = fetch(x0, y0 + 1).lerp(fetch(x0 + 1, y0 + 1), tx);
+	return top.lerp(bottom, ty);
+}
+
+// Edge function of the segment from p_a to p_b, evaluated in a canonical vertex order so
+// two triangles sharing an edge get exactly opposite values.
+static _FORCE_INLINE_ real_t _edge_function(const Vector2 &p_a, const Vector2 &p_b, const Vector2 &p_point) {
+	if (p_a < p_b) {
+		return (p_b - p_a).cross(p_point - p_a);
+	}
+	return -(p_a - p_b).cross(p_point - p_b);
+}
+
+// Pixel centers exactly on an edge belong to only one of the two triangles sharing it.
+static _FORCE_INLINE_ bool _edge_owns_boundary(const Vector2 &p_a, const Vector2 &p_b) {
+	const Vector2 d = p_b - p_a;
+	return d.y > 0 || (d.y == 0 && d.x < 0);
+}
+
+void RasterizerCanvasSoftware::_rasterize_triangle(const Triangle &p_triangle, const Rect2i &p_tile) const {
+	const Rect2i area = p_triangle.bounds.intersection(p_tile);
+	if (!area.has_area()) {
+		return;
+	}
+
+	// Wind the triangle so inside points have positive edge functions.
+	int i1 = 1;
+	int i2 = 2;
+	real_t double_area = (p_triangle.points[1] - p_triangle.points[0]).cross(p_triangle.points[2] - p_triangle.points[0]);
+	if (double_area == 0) {
+		return;
+	}
+	if (double_area < 0) {
+		SWAP(i1, i2);
+		double_area = -double_area;
+	}
+	const Vector2 &v0 = p_triangle.points[0];
+	const Vector2 &v1 = p_triangle.points[i1];
+	const Vector2 &v2 = p_triangle.points[i2];
+	const bool owns_12 = _edge_owns_boundary(v1, v2);
+	const bool owns_20 = _edge_owns_boundary(v2, v0);
+	const bool owns_01 = _edge_owns_boundary(v0, v1);
+
+	const SourceTexture *texture = p_triangle.texture >= 0 ? &textures[p_triangle.texture] : nullptr;
+	const bool clip_uv = p_triangle.uv_clip.has_area();
+	const real_t inv_area = 1.0 / double_area;
+
+	for (int y = area.position.y; y < area.get_end().y; y++) {
+		uint8_t *row = target_data + (size_t(y) * target_size.width) * 4;
+		for (int x = area.position.x; x < area.get_end().x; x++) {
+			const Vector2 center(x + 0.5, y + 0.5);
+			const real_t w0 = _edge_function(v1, v2, center);
+			const real_t w1 = _edge_function(v2, v0, center);
+			const real_t w2 = _edge_function(v0, v1, center);
+			if (w0 < 0 || w1 < 0 || w2 < 0 || (w0 == 0 && !owns_12) || (w1 == 0 && !owns_20) || (w2 == 0 && !owns_01)) {
+				continue;
+			}
+
+			const float b0 = w0 * inv_area;
+			const float b1 = w1 * inv_area;
+			const float b2 = w2 * inv_area;
+
+			Color color = p_triangle.colors[0] * b0 + p_triangle.colors[i1] * b1 + p_triangle.colors[i2] * b2;
+			if (texture) {
+				Vector2 uv = p_triangle.uvs[0] * b0 + p_triangle.uvs[i1] * b1 + p_triangle.uvs[i2] * b2;
+				if (clip_uv) {
+					uv = uv.clamp(p_triangle.uv_clip.position, p_triangle.uv_clip.get_end());
+				}
+				color *= _sample(*texture, uv, p_triangle.filter_linear, p_triangle.repeat);
+			}
+
+			const float alpha = CLAMP(color.a, 0.0f, 1.0f);
+			if (alpha <= 0.0f) {
+				continue;
+			}
+
+			// Regular "mix" blending, with the alpha channel accumulated like the GPU renderers do.
+			uint8_t *pixel = row + x * 4;
+			const float inv_alpha = 1.0f - alpha;
+			const float out[4] = {
+				color.r * alpha + pixel[0] / 255.0f * inv_alpha,
+				color.g * alpha + pixel[1] / 255.0f * inv_alpha,
+				color.b * alpha + pixel[2] / 255.0f * inv_alpha,
+				alpha + pixel[3] / 255.0f * inv_alpha,
+			};
+			for (int i = 0; i < 4; i++) {
+				pixel[i] = uint8_t(CLAMP(int(out[i] * 255.0f + 0.5f), 0, 255));
+			}
+		}
+	}
+}
+
+void RasterizerCanvasSoftware::_render_tile_task(uint32_t p_index, const Rect2i *p_tiles) {
+	const Rect2i &tile = p_tiles[p_index];
+	for (const Triangle &triangle : triangles) {
+		if (triangle.bounds.intersects(tile)) {
+			_rasterize_triangle(triangle, tile);
+		}
+	}
+}
+
+void RasterizerCanvasSoftware::canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_list, const Transform2D &p_canvas_transform, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used, RenderingMethod::RenderInfo *r_render_info) {
+	RendererDummy::TextureStorage *texture_storage = RendererDummy::TextureStorage::get_singleton();
+	if (!texture_storage->owns_render_target(p_to_render_target)) {
+		return;
+	}
+
+	texture_storage->render_target_do_clear_request(p_to_render_target);
+
+	target_data = texture_storage->render_target_get_software_data(p_to_render_target, target_size);
+	if (!target_data) {
+		return;
+	}
+
+	uint32_t item_count = 0;
+	for (const Item *ci = p_item_list; ci; ci = ci->next) {
+		_add_item(ci, p_modulate, p_default_filter, p_default_repeat);
+		item_count++;
+	}
+
+	if (!triangles.is_empty()) {
+		for (int y = 0; y < target_size.height; y += TILE_SIZE) {
+			for (int x = 0; x < target_size.width; x += TILE_SIZE) {
+				tiles.push_back(Rect2i(x, y, MIN(TILE_SIZE, target_size.width - x), MIN(TILE_SIZE, target_size.height - y)));
+			}
+		}
+
+		// Tiles cover separate pixels, so they can be rasterized in parallel.
+		if (tiles.size() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterizerCanvasSoftware::_render_tile_task, tiles.ptr(), tiles.size(), -1, true, SNAME("RasterizerCanvasSoftwareTiles"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_render_tile_task(0, tiles.ptr());
+		}
+	}
+
+	if (r_render_info) {
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME] += item_count;
+		r_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_CANVAS][RS::VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME] += triangles.size();
+	}
+
+	triangles.clear();
+	tiles.clear();
+	textures.clear();
+	texture_indices.clear();
+	target_data = nullptr;
+}
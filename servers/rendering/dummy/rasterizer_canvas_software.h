@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  rasterizer_canvas_software.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef RASTERIZER_CANVAS_SOFTWARE_H
+#define RASTERIZER_CANVAS_SOFTWARE_H
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "servers/rendering/renderer_canvas_render.h"
+
+// Draws canvas items on the CPU into the render targets of the dummy texture
+// storage, so 2D output can be read back with no GPU available. Rects,
+// nine-patches, triangle polygons and primitives are supported, modulated and
+// alpha blended. Materials, lights, shadows, SDF, canvas groups and meshes are
+// ignored.
+class RasterizerCanvasSoftware : public RendererCanvasRender {
+	// The render target is split in square tiles rasterized in parallel.
+	static constexpr int TILE_SIZE = 64;
+
+	struct PolygonData {
+		LocalVector<int> indices;
+		LocalVector<Vector2> points;
+		LocalVector<Color> colors;
+		LocalVector<Vector2> uvs;
+	};
+
+	HashMap<PolygonID, PolygonData> polygons;
+	PolygonID last_polygon_id = 0;
+
+	enum TextureRepeat : uint8_t {
+		TEXTURE_REPEAT_DISABLED,
+		TEXTURE_REPEAT_ENABLED,
+		TEXTURE_REPEAT_MIRROR,
+	};
+
+	struct SourceTexture {
+		const uint8_t *data = nullptr;
+		Size2i size;
+	};
+
+	struct Triangle {
+		Vector2 points[3]; // In render target pixels.
+		Vector2 uvs[3];
+		Color colors[3];
+		Rect2i bounds; // Pixels that may be covered, clipped.
+		Rect2 uv_clip; // Only used when it has an area.
+		int32_t texture = -1;
+		bool filter_linear = false;
+		TextureRepeat repeat = TEXTURE_REPEAT_DISABLED;
+	};
+
+	// Per draw state, rebuilt by each call to canvas_render_items().
+	LocalVector<SourceTexture> textures;
+	HashMap<RID, int32_t> texture_indices;
+	LocalVector<Triangle> triangles;
+	LocalVector<Rect2i> tiles;
+	uint8_t *target_data = nullptr;
+	Size2i target_size;
+
+	int32_t _get_texture(RID p_texture, Size2 &r_size);
+	void _add_triangle(const Vector2 *p_points, const Vector2 *p_uvs, const Color *p_colors, const Transform2D &p_xform, const Rect2i &p_clip, int32_t p_texture, bool p_filter_linear, TextureRepeat p_repeat, const Rect2 &p_uv_clip = Rect2());
+	void _add_rect(const Rect2 &p_rect, const Rect2 &p_uv_rect, bool p_transpose, const Color &p_color, const Transform2D &p_xform, const Rect2i &p_clip, int32_t p_texture, bool p_filter_linear, TextureRepeat p_repeat, const Rect2 &p_uv_clip = Rect2());
+	void _add_item(const Item *p_item, const Color &p_modulate, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat);
+
+	Color _sample(const SourceTexture &p_texture, const Vector2 &p_uv, bool p_filter_linear, TextureRepeat p_repeat) const;
+	void _rasterize_triangle(const Triangle &p_triangle, const Rect2i &p_tile) const;
+	void _render_tile_task(uint32_t p_index, const Rect2i *p_tiles);
+
+public:
+	PolygonID request_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs = Vector<Point2>(), const Vector<int> &p_bones = Vector<int>(), const Vector<float> &p_weights = Vector<float>()) override;
+	void free_polygon(PolygonID p_polygon) override;
+
+	void canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_list, const Transform2D &p_canvas_transform, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used, RenderingMethod::RenderInfo *r_render_info = nullptr) override;
+
+	RID light_create() override { return RID(); }
+	void light_set_texture(RID p_rid, RID p_texture) override {}
+	void light_set_use_shadow(RID p_rid, bool p_enable) override {}
+	void light_update_shadow(RID p_rid, int p_shadow_index, const Transform2D &p_light_xform, int p_light_mask, float p_near, float p_far, LightOccluderInstance *p_occluders, const Rect2 &p_light_rect) override {}
+	void light_update_directional_shadow(RID p_rid, int p_shadow_index, const Transform2D &p_light_xform, int p_light_mask, float p_cull_distance, const Rect2 &p_clip_rect, LightOccluderInstance *p_occluders) override {}
+
+	void render_sdf(RID p_render_target, LightOccluderInstance *p_occluders) override {}
+	RID occluder_polygon_create() override { return RID(); }
+	void occluder_polygon_set_shape(RID p_occluder, const Vector<Vector2> &p_points, bool p_closed) override {}
+	void occluder_polygon_set_cull_mode(RID p_occluder, RS::CanvasOccluderPolygonCullMode p_mode) override {}
+	void set_shadow_texture_size(int p_size) override {}
+
+	bool free(RID p_rid) override { return true; }
+	void update() override {}
+
+	virtual void set_debug_redraw(bool p_enabled, double p_time, const Color &p_color) override {}
+	virtual uint32_t get_pipeline_compilations(RS::PipelineSource p_source) override { return 0; }
+
+	RasterizerCanvasSoftware() {}
+	~RasterizerCanvasSoftware() {}
+};
+
+#endif // RASTERIZER_CANVAS_SOFTWARE_H
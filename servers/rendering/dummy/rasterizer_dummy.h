@@ -31,12 +31,14 @@
 #ifndef RASTERIZER_DUMMY_H
 #define RASTERIZER_DUMMY_H
 
+#include "core/config/project_settings.h"
 #include "core/templates/rid_owner.h"
 #include "core/templates/self_list.h"
 #include "scene/resources/mesh.h"
 #include "servers/rendering/dummy/environment/fog.h"
 #include "servers/rendering/dummy/environment/gi.h"
 #include "servers/rendering/dummy/rasterizer_canvas_dummy.h"
+#include "servers/rendering/dummy/rasterizer_canvas_software.h"
 #include "servers/rendering/dummy/rasterizer_scene_dummy.h"
 #include "servers/rendering/dummy/storage/light_storage.h"
 #include "servers/rendering/dummy/storage/material_storage.h"
@@ -54,7 +56,7 @@ private:
 	double time = 0.0;
 
 protected:
-	RasterizerCanvasDummy canvas;
+	RendererCanvasRender *canvas = nullptr;
 	RendererDummy::Utilities utilities;
 	RendererDummy::LightStorage light_storage;
 	RendererDummy::MaterialStorage material_storage;
@@ -74,7 +76,7 @@ public:
 	RendererTextureStorage *get_texture_storage() override { return &texture_storage; }
 	RendererGI *get_gi() override { return &gi; }
 	RendererFog *get_fog() override { return &fog; }
-	RendererCanvasRender *get_canvas() override { return &canvas; }
+	RendererCanvasRender *get_canvas() override { return canvas; }
 	RendererSceneRender *get_scene() override { return &scene; }
 
 	void set_boot_image(const Ref<Image> &p_image, const Color &p_color, bool p_scale, bool p_use_filter = true) override {}
@@ -112,8 +114,19 @@ public:
 	double get_total_time() const override { return time; }
 	bool can_create_resources_async() const override { return false; }
 
-	RasterizerDummy() {}
-	~RasterizerDummy() {}
+	RasterizerDummy() {
+		// Only one canvas renderer may exist, and render targets only hold pixels when it draws them.
+		const bool software_canvas = GLOBAL_GET("rendering/2d/software_canvas/enabled");
+		texture_storage.set_software_render_targets(software_canvas);
+		if (software_canvas) {
+			canvas = memnew(RasterizerCanvasSoftware);
+		} else {
+			canvas = memnew(RasterizerCanvasDummy);
+		}
+	}
+	~RasterizerDummy() {
+		memdelete(canvas);
+	}
 };
 
 #endif // RASTERIZER_DUMMY_H
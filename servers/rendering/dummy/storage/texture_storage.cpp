@@ -41,3 +41,195 @@ TextureStorage::TextureStorage() {
 TextureStorage::~TextureStorage() {
 	singleton = nullptr;
 }
+
+TextureStorage::DummyTexture *TextureStorage::_texture_resolve_proxy(RID p_texture) const {
+	DummyTexture *t = texture_owner.get_or_null(p_texture);
+	// Proxies may point to other proxies, but never in a loop.
+	for (int i = 0; t && t->proxy_to.is_valid() && i < 8; i++) {
+		t = texture_owner.get_or_null(t->proxy_to);
+	}
+	return t;
+}
+
+Ref<Image> TextureStorage::texture_2d_get(RID p_texture) const {
+	const DummyTexture *t = _texture_resolve_proxy(p_texture);
+	ERR_FAIL_NULL_V(t, Ref<Image>());
+	if (t->render_target.is_valid()) {
+		const DummyRenderTarget *rt = render_target_owner.get_or_null(t->render_target);
+		ERR_FAIL_NULL_V(rt, Ref<Image>());
+		if (rt->data.is_empty()) {
+			return Ref<Image>();
+		}
+		return Image::create_from_data(rt->size.width, rt->size.height, false, Image::FORMAT_RGBA8, rt->data);
+	}
+	return t->image;
+}
+
+/* RENDER TARGET API */
+
+RID TextureStorage::render_target_create() {
+	if (!software_render_targets) {
+		return RID();
+	}
+
+	DummyRenderTarget *rt = memnew(DummyRenderTarget);
+	RID rid = render_target_owner.make_rid(rt);
+
+	DummyTexture *texture = memnew(DummyTexture);
+	texture->render_target = rid;
+	rt->texture = texture_owner.make_rid(texture);
+
+	return rid;
+}
+
+void TextureStorage::render_target_free(RID p_rid) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_rid);
+	ERR_FAIL_NULL(rt);
+
+	DummyTexture *texture = texture_owner.get_or_null(rt->texture);
+	if (texture) {
+		texture_owner.free(rt->texture);
+		memdelete(texture);
+	}
+
+	render_target_owner.free(p_rid);
+	memdelete(rt);
+}
+
+void TextureStorage::render_target_set_size(RID p_render_target, int p_width, int p_height, uint32_t p_view_count) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL(rt);
+
+	Size2i size(MAX(p_width, 0), MAX(p_height, 0));
+	if (rt->size == size) {
+		return;
+	}
+	rt->size = size;
+	rt->data.resize(size.width * size.height * 4);
+	rt->data.fill(0);
+}
+
+Size2i TextureStorage::render_target_get_size(RID p_render_target) const {
+	const DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, Size2i());
+	return rt->size;
+}
+
+void TextureStorage::render_target_set_transparent(RID p_render_target, bool p_is_transparent) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL(rt);
+	rt->is_transparent = p_is_transparent;
+}
+
+bool TextureStorage::render_target_get_transparent(RID p_render_target) const {
+	const DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, false);
+	return rt->is_transparent;
+}
+
+bool TextureStorage::render_target_was_used(RID p_render_target) const {
+	const DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, false);
+	return rt->used;
+}
+
+void TextureStorage::render_target_set_as_unused(RID p_render_target) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL(rt);
+	rt->used = false;
+}
+
+void TextureStorage::render_target_request_clear(RID p_render_target, const Color &p_clear_color) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL(rt);
+	rt->clear_requested = true;
+	rt->clear_color = p_clear_color;
+}
+
+bool TextureStorage::render_target_is_clear_requested(RID p_render_target) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, false);
+	return rt->clear_requested;
+}
+
+Color TextureStorage::render_target_get_clear_request_color(RID p_render_target) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, Color());
+	return rt->clear_color;
+}
+
+void TextureStorage::render_target_disable_clear_request(RID p_render_target) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL(rt);
+	rt->clear_requested = false;
+}
+
+void TextureStorage::render_target_do_clear_request(RID p_render_target) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt || !rt->clear_requested) {
+		return;
+	}
+	rt->clear_requested = false;
+
+	Color color = rt->clear_color;
+	if (!rt->is_transparent) {
+		color.a = 1.0;
+	}
+	const uint32_t pixel = color.to_abgr32(); // 0xAABBGGRR.
+	const uint8_t bytes[4] = { uint8_t(pixel & 0xFF), uint8_t((pixel >> 8) & 0xFF), uint8_t((pixel >> 16) & 0xFF), uint8_t(pixel >> 24) };
+
+	uint8_t *w = rt->data.ptrw();
+	const int pixel_count = rt->size.width * rt->size.height;
+	for (int i = 0; i < pixel_count; i++) {
+		memcpy(w + i * 4, bytes, 4);
+	}
+}
+
+RID TextureStorage::render_target_get_texture(RID p_render_target) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	ERR_FAIL_NULL_V(rt, RID());
+	return rt->texture;
+}
+
+/* SOFTWARE CANVAS API */
+
+const uint8_t *TextureStorage::texture_get_software_data(RID p_texture, Size2i &r_size) {
+	DummyTexture *t = _texture_resolve_proxy(p_texture);
+	if (!t) {
+		return nullptr;
+	}
+
+	if (t->render_target.is_valid()) {
+		DummyRenderTarget *rt = render_target_owner.get_or_null(t->render_target);
+		if (!rt || rt->data.is_empty()) {
+			return nullptr;
+		}
+		rt->used = true;
+		r_size = rt->size;
+		return rt->data.ptr();
+	}
+
+	if (t->image.is_null() || t->image->is_empty()) {
+		return nullptr;
+	}
+	if (t->software_image.is_null()) {
+		Ref<Image> image = t->image->duplicate();
+		if (image->is_compressed()) {
+			image->decompress();
+		}
+		image->clear_mipmaps();
+		image->convert(Image::FORMAT_RGBA8);
+		t->software_image = image;
+	}
+	r_size = t->software_image->get_size();
+	return t->software_image->ptr();
+}
+
+uint8_t *TextureStorage::render_target_get_software_data(RID p_render_target, Size2i &r_size) {
+	DummyRenderTarget *rt = render_target_owner.get_or_null(p_render_target);
+	if (!rt || rt->data.is_empty()) {
+		return nullptr;
+	}
+	r_size = rt->size;
+	return rt->data.ptrw();
+}
@@ -41,9 +41,28 @@ private:
 
 	struct DummyTexture {
 		Ref<Image> image;
+		RID proxy_to;
+		RID render_target;
+		Ref<Image> software_image; // RGBA8 copy of `image`, created on demand for the software canvas renderer.
 	};
 	mutable RID_PtrOwner<DummyTexture> texture_owner;
 
+	// Render targets only hold pixels when the software canvas renderer is used,
+	// otherwise they are not allocated at all.
+	struct DummyRenderTarget {
+		Size2i size;
+		bool is_transparent = false;
+		bool used = false;
+		bool clear_requested = false;
+		Color clear_color;
+		RID texture;
+		Vector<uint8_t> data; // RGBA8.
+	};
+	mutable RID_PtrOwner<DummyRenderTarget> render_target_owner;
+	bool software_render_targets = false;
+
+	DummyTexture *_texture_resolve_proxy(RID p_texture) const;
+
 public:
 	static TextureStorage *get_singleton() { return singleton; }
 
@@ -76,6 +95,7 @@ public:
 		// delete the texture
 		DummyTexture *texture = texture_owner.get_or_null(p_rid);
 		ERR_FAIL_NULL(texture);
+		ERR_FAIL_COND_MSG(texture->render_target.is_valid(), "Render target textures can't be freed directly, free the render target instead.");
 		texture_owner.free(p_rid);
 		memdelete(texture);
 	}
@@ -88,25 +108,33 @@ public:
 	virtual void texture_2d_layered_initialize(RID p_texture, const Vector<Ref<Image>> &p_layers, RS::TextureLayeredType p_layered_type) override {}
 	virtual void texture_3d_initialize(RID p_texture, Image::Format, int p_width, int p_height, int p_depth, bool p_mipmaps, const Vector<Ref<Image>> &p_data) override {}
 	virtual void texture_external_initialize(RID p_texture, int p_width, int p_height, uint64_t p_external_buffer) override {}
-	virtual void texture_proxy_initialize(RID p_texture, RID p_base) override {} //all slices, then all the mipmaps, must be coherent
+	virtual void texture_proxy_initialize(RID p_texture, RID p_base) override { //all slices, then all the mipmaps, must be coherent
+		texture_proxy_update(p_texture, p_base);
+	}
 
 	virtual RID texture_create_from_native_handle(RS::TextureType p_type, Image::Format p_format, uint64_t p_native_handle, int p_width, int p_height, int p_depth, int p_layers = 1, RS::TextureLayeredType p_layered_type = RS::TEXTURE_LAYERED_2D_ARRAY) override { return RID(); }
 
-	virtual void texture_2d_update(RID p_texture, const Ref<Image> &p_image, int p_layer = 0) override {}
+	virtual void texture_2d_update(RID p_texture, const Ref<Image> &p_image, int p_layer = 0) override {
+		DummyTexture *t = texture_owner.get_or_null(p_texture);
+		ERR_FAIL_NULL(t);
+		ERR_FAIL_COND(p_image.is_null());
+		t->image = p_image->duplicate();
+		t->software_image.unref();
+	}
 	virtual void texture_3d_update(RID p_texture, const Vector<Ref<Image>> &p_data) override {}
 	virtual void texture_external_update(RID p_texture, int p_width, int p_height, uint64_t p_external_buffer) override {}
-	virtual void texture_proxy_update(RID p_proxy, RID p_base) override {}
+	virtual void texture_proxy_update(RID p_proxy, RID p_base) override {
+		DummyTexture *t = texture_owner.get_or_null(p_proxy);
+		ERR_FAIL_NULL(t);
+		t->proxy_to = p_base;
+	}
 
 	//these two APIs can be used together or in combination with the others.
 	virtual void texture_2d_placeholder_initialize(RID p_texture) override {}
 	virtual void texture_2d_layered_placeholder_initialize(RID p_texture, RenderingServer::TextureLayeredType p_layered_type) override {}
 	virtual void texture_3d_placeholder_initialize(RID p_texture) override {}
 
-	virtual Ref<Image> texture_2d_get(RID p_texture) const override {
-		DummyTexture *t = texture_owner.get_or_null(p_texture);
-		ERR_FAIL_NULL_V(t, Ref<Image>());
-		return t->image;
-	}
+	virtual Ref<Image> texture_2d_get(RID p_texture) const override;
 	virtual Ref<Image> texture_2d_layer_get(RID p_texture, int p_layer) const override { return Ref<Image>(); }
 	virtual Vector<Ref<Image>> texture_3d_get(RID p_texture) const override { return Vector<Ref<Image>>(); }
 
@@ -162,21 +190,24 @@ public:
 
 	/* RENDER TARGET */
 
-	virtual RID render_target_create() override { return RID(); }
-	virtual void render_target_free(RID p_rid) override {}
+	void set_software_render_targets(bool p_enabled) { software_render_targets = p_enabled; }
+	bool owns_render_target(RID p_rid) { return render_target_owner.owns(p_rid); }
+
+	virtual RID render_target_create() override;
+	virtual void render_target_free(RID p_rid) override;
 	virtual void render_target_set_position(RID p_render_target, int p_x, int p_y) override {}
 	virtual Point2i render_target_get_position(RID p_render_target) const override { return Point2i(); }
-	virtual void render_target_set_size(RID p_render_target, int p_width, int p_height, uint32_t p_view_count) override {}
-	virtual Size2i render_target_get_size(RID p_render_target) const override { return Size2i(); }
+	virtual void render_target_set_size(RID p_render_target, int p_width, int p_height, uint32_t p_view_count) override;
+	virtual Size2i render_target_get_size(RID p_render_target) const override;
 #ifdef PIXEL_ENGINE
 	virtual void render_target_set_clear_color(RID p_render_target, const Color &p_color) override {}
 #endif // PIXEL_ENGINE
-	virtual void render_target_set_transparent(RID p_render_target, bool p_is_transparent) override {}
-	virtual bool render_target_get_transparent(RID p_render_target) const override { return false; }
+	virtual void render_target_set_transparent(RID p_render_target, bool p_is_transparent) override;
+	virtual bool render_target_get_transparent(RID p_render_target) const override;
 	virtual void render_target_set_direct_to_screen(RID p_render_target, bool p_direct_to_screen) override {}
 	virtual bool render_target_get_direct_to_screen(RID p_render_target) const override { return false; }
-	virtual bool render_target_was_used(RID p_render_target) const override { return false; }
-	virtual void render_target_set_as_unused(RID p_render_target) override {}
+	virtual bool render_target_was_used(RID p_render_target) const override;
+	virtual void render_target_set_as_unused(RID p_render_target) override;
 	virtual void render_target_set_msaa(RID p_render_target, RS::ViewportMSAA p_msaa) override {}
 	virtual RS::ViewportMSAA render_target_get_msaa(RID p_render_target) const override { return RS::VIEWPORT_MSAA_DISABLED; }
 	virtual void render_target_set_msaa_needs_resolve(RID p_render_target, bool p_needs_resolve) override {}
@@ -185,11 +216,11 @@ public:
 	virtual void render_target_set_use_hdr(RID p_render_target, bool p_use_hdr_2d) override {}
 	virtual bool render_target_is_using_hdr(RID p_render_target) const override { return false; }
 
-	virtual void render_target_request_clear(RID p_render_target, const Color &p_clear_color) override {}
-	virtual bool render_target_is_clear_requested(RID p_render_target) override { return false; }
-	virtual Color render_target_get_clear_request_color(RID p_render_target) override { return Color(); }
-	virtual void render_target_disable_clear_request(RID p_render_target) override {}
-	virtual void render_target_do_clear_request(RID p_render_target) override {}
+	virtual void render_target_request_clear(RID p_render_target, const Color &p_clear_color) override;
+	virtual bool render_target_is_clear_requested(RID p_render_target) override;
+	virtual Color render_target_get_clear_request_color(RID p_render_target) override;
+	virtual void render_target_disable_clear_request(RID p_render_target) override;
+	virtual void render_target_do_clear_request(RID p_render_target) override;
 
 	virtual void render_target_set_sdf_size_and_scale(RID p_render_target, RS::ViewportSDFOversize p_size, RS::ViewportSDFScale p_scale) override {}
 	virtual Rect2i render_target_get_sdf_rect(RID p_render_target) const override { return Rect2i(); }
@@ -208,7 +239,14 @@ public:
 	virtual RID render_target_get_override_velocity(RID p_render_target) const override { return RID(); }
 	virtual RID render_target_get_override_velocity_depth(RID p_render_target) const override { return RID(); }
 
-	virtual RID render_target_get_texture(RID p_render_target) override { return RID(); }
+	virtual RID render_target_get_texture(RID p_render_target) override;
+
+	/* SOFTWARE CANVAS */
+
+	// RGBA8 pixels of a texture, following proxies. Returns nullptr if the texture has no image.
+	const uint8_t *texture_get_software_data(RID p_texture, Size2i &r_size);
+	// RGBA8 pixels of a render target, writable by the software canvas renderer.
+	uint8_t *render_target_get_software_data(RID p_render_target, Size2i &r_size);
 
 	virtual void render_target_set_velocity_target_size(RID p_render_target, const Size2i &p_target_size) override {}
 	virtual Size2i render_target_get_velocity_target_size(RID p_render_target) const override { return Size2i(0, 0); }
@@ -33,6 +33,8 @@
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/transform_interpolator.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/frame_allocator.h"
 #include "renderer_viewport.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
@@ -70,28 +72,46 @@ void RendererCanvasCull::_dependency_deleted(const RID &p_dependency, Dependency
 void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas::ChildItem *p_child_items, int p_child_item_count, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, RenderingServer::CanvasItemTextureFilter p_default_filter, RenderingServer::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, uint32_t p_canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info) {
 	RENDER_TIMESTAMP("Cull CanvasItem Tree");
 
-	memset(z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
-	memset(z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+	_update_cull_indices();
 
-	for (int i = 0; i < p_child_item_count; i++) {
-		_cull_canvas_item(p_child_items[i].item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, false, p_canvas_cull_mask, Point2(), 1, nullptr);
+	{
+		// Cull index results live in the frame allocator, until the cull pass ends.
+		FrameAllocator::Scope frame_scope;
+
+		thread_cull_deferring = WorkerThreadPool::get_singleton()->get_thread_count() > 1;
+		for (int i = 0; i < p_child_item_count; i++) {
+			_cull_canvas_item(p_child_items[i].item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_lists, nullptr, nullptr, false, p_canvas_cull_mask, Point2(), 1, nullptr);
+		}
+		thread_cull_deferring = false;
+
+		if (!cull_chunks.is_empty()) {
+			_cull_deferred_chunks();
+		}
+	}
+
+	if (redraw_requested.is_set()) {
+		redraw_requested.clear();
+		RenderingServerDefault::redraw_request();
 	}
 
 	RendererCanvasRender::Item *list = nullptr;
 	RendererCanvasRender::Item *list_end = nullptr;
 
 	for (int i = 0; i < z_range; i++) {
-		if (!z_list[i]) {
+		if (!z_lists.first[i]) {
 			continue;
 		}
 		if (!list) {
-			list = z_list[i];
-			list_end = z_last_list[i];
+			list = z_lists.first[i];
+			list_end = z_lists.last[i];
 		} else {
-			list_end->next = z_list[i];
-			list_end = z_last_list[i];
+			list_end->next = z_lists.first[i];
+			list_end = z_lists.last[i];
 		}
+		z_lists.first[i] = nullptr;
+		z_lists.last[i] = nullptr;
 	}
+	z_lists.used.clear();
 
 	RENDER_TIMESTAMP("Render CanvasItems");
 
@@ -121,7 +141,9 @@ void RendererCanvasCull::_collect_ysort_children(RendererCanvasCull::Item *p_can
 				child_xform.columns[2] = (child_xform.columns[2] + Point2(0.5, 0.5)).floor();
 			}
 
-			r_items[r_index] = child_items[i];
+			if (r_items) {
+				r_items[r_index] = child_items[i];
+			}
 			child_items[i]->ysort_xform = p_canvas_item->ysort_xform * child_xform;
 			child_items[i]->material_owner = child_items[i]->use_parent_material ? p_material_owner : nullptr;
 			child_items[i]->ysort_modulate = p_modulate;
@@ -166,6 +188,29 @@ int RendererCanvasCull::_count_ysort_children(RendererCanvasCull::Item *p_canvas
 	return ysort_children_count;
 }
 
+void RendererCanvasCull::_repair_ysort_order(RendererCanvasCull::Item **p_items, int p_item_count) {
+	// Insertion sort, linear when nothing moved. Falls back to a full sort when too many items moved
+	// too far to keep it cheap.
+	ItemYSort compare;
+	int64_t moves_left = int64_t(p_item_count) * YSORT_REPAIR_MOVES_PER_ITEM;
+	for (int i = 1; i < p_item_count; i++) {
+		Item *item = p_items[i];
+		int j = i;
+		while (j > 0 && compare(item, p_items[j - 1])) {
+			p_items[j] = p_items[j - 1];
+			j--;
+		}
+		p_items[j] = item;
+
+		moves_left -= i - j;
+		if (moves_left < 0) {
+			SortArray<Item *, ItemYSort> sorter;
+			sorter.sort(p_items, p_item_count);
+			return;
+		}
+	}
+}
+
 void RendererCanvasCull::_mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner) {
 	do {
 		ysort_owner->ysort_children_count = -1;
@@ -173,7 +218,242 @@ void RendererCanvasCull::_mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner
 	} while (ysort_owner && ysort_owner->sort_y);
 }
 
-void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *ci, RendererCanvasCull::Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &p_modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from) {
+void RendererCanvasCull::_item_cull_bounds_changed(Item *p_item) {
+	if (p_item->in_parent_cull_index && !p_item->cull_index_update_item.in_list()) {
+		_canvas_cull_singleton->_cull_index_update_list.add(&p_item->cull_index_update_item);
+	}
+}
+
+bool RendererCanvasCull::_is_cull_index_leaf(const Item *p_item) const {
+	// Items whose drawing doesn't only depend on their own rect intersecting the clip rect.
+	return p_item->child_items.is_empty() && !p_item->vp_render && !p_item->copy_back_buffer && !p_item->repeat_source && !p_item->canvas_group && !p_item->update_when_visible && p_item->skeleton.is_null();
+}
+
+void RendererCanvasCull::_cull_index_insert(ChildCullIndex *p_index, Item *p_item) {
+	DEV_ASSERT(!p_item->in_parent_cull_index);
+	p_item->in_parent_cull_index = true;
+
+	if (!_is_cull_index_leaf(p_item)) {
+		p_index->unindexed.push_back(p_item);
+		return;
+	}
+
+	Rect2 rect = p_item->get_rect();
+	if (p_item->visibility_notifier && p_item->visibility_notifier->area.size != Vector2()) {
+		rect = rect.merge(p_item->visibility_notifier->area);
+	}
+	// Grown to account for transform snapping.
+	rect = p_item->xform_curr.xform(rect).grow(1.0);
+
+	const AABB aabb(Vector3(rect.position.x, rect.position.y, 0), Vector3(rect.size.x, rect.size.y, 0));
+	if (p_item->cull_index_id.is_valid()) {
+		p_index->bvh.update(p_item->cull_index_id, aabb);
+	} else {
+		p_item->cull_index_id = p_index->bvh.insert(aabb, p_item);
+	}
+}
+
+void RendererCanvasCull::_cull_index_remove(ChildCullIndex *p_index, Item *p_item) {
+	DEV_ASSERT(p_item->in_parent_cull_index);
+	p_item->in_parent_cull_index = false;
+
+	if (p_item->cull_index_id.is_valid()) {
+		p_index->bvh.remove(p_item->cull_index_id);
+		p_item->cull_index_id = DynamicBVH::ID();
+	} else {
+		p_index->unindexed.erase(p_item);
+	}
+	if (p_item->cull_index_update_item.in_list()) {
+		_cull_index_update_list.remove(&p_item->cull_index_update_item);
+	}
+}
+
+void RendererCanvasCull::_free_child_cull_index(Item *p_item) {
+	if (!p_item->child_cull_index) {
+		return;
+	}
+
+	for (Item *child : p_item->child_items) {
+		child->in_parent_cull_index = false;
+		child->cull_index_id = DynamicBVH::ID();
+		if (child->cull_index_update_item.in_list()) {
+			_cull_index_update_list.remove(&child->cull_index_update_item);
+		}
+	}
+	memdelete(p_item->child_cull_index);
+	p_item->child_cull_index = nullptr;
+}
+
+void RendererCanvasCull::_update_cull_indices() {
+	while (_cull_index_update_list.first()) {
+		Item *item = _cull_index_update_list.first()->self();
+		_cull_index_update_list.remove(&item->cull_index_update_item);
+
+		Item *parent = canvas_item_owner.get_or_null(item->parent);
+		ERR_CONTINUE(!parent || !parent->child_cull_index);
+
+		// Inserting again updates the rect of indexed items in place.
+		if (item->cull_index_id.is_valid() && _is_cull_index_leaf(item)) {
+			item->in_parent_cull_index = false;
+		} else {
+			_cull_index_remove(parent->child_cull_index, item);
+		}
+		_cull_index_insert(parent->child_cull_index, item);
+	}
+}
+
+int RendererCanvasCull::_cull_index_query(Item *p_canvas_item, const Transform2D &p_xform, const Rect2 &p_clip_rect, Item **&r_child_items) {
+	const int child_item_count = p_canvas_item->child_items.size();
+	if (Math::is_zero_approx(p_xform.determinant())) {
+		return child_item_count;
+	}
+
+	ChildCullIndex *index = p_canvas_item->child_cull_index;
+	if (!index) {
+		index = memnew(ChildCullIndex);
+		p_canvas_item->child_cull_index = index;
+		for (Item *child : p_canvas_item->child_items) {
+			_cull_index_insert(index, child);
+		}
+	}
+
+	if (index->order_dirty) {
+		for (int i = 0; i < child_item_count; i++) {
+			p_canvas_item->child_items[i]->cull_order = i;
+		}
+		index->order_dirty = false;
+	}
+
+	// Global rects are tested against the clip rect after being offset by its position,
+	// see `_cull_canvas_item()`. Grown to account for transform snapping.
+	const Rect2 local_clip_rect = p_xform.affine_inverse().xform(Rect2(Point2(), p_clip_rect.size).grow(1.0));
+
+	struct CullResult {
+		FrameVector<Item *> *items = nullptr;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			items->push_back((Item *)p_data);
+			return false;
+		}
+	};
+
+	FrameVector<Item *> visible_children;
+	visible_children.reserve(index->unindexed.size() + 64);
+	for (Item *child : index->unindexed) {
+		visible_children.push_back(child);
+	}
+
+	CullResult result;
+	result.items = &visible_children;
+	index->bvh.aabb_query(AABB(Vector3(local_clip_rect.position.x, local_clip_rect.position.y, -1), Vector3(local_clip_rect.size.x, local_clip_rect.size.y, 2)), result);
+
+	SortArray<Item *, ItemCullOrderSort> sorter;
+	sorter.sort(visible_children.ptr(), visible_children.size());
+
+	r_child_items = visible_children.ptr();
+	return visible_children.size();
+}
+
+void RendererCanvasCull::_take_z_lists(ZLists &r_z_lists, LocalVector<ZListSpan> &r_spans) {
+	for (uint32_t zidx : r_z_lists.used) {
+		ZListSpan span;
+		span.zidx = zidx;
+		span.first = r_z_lists.first[zidx];
+		span.last = r_z_lists.last[zidx];
+		r_spans.push_back(span);
+
+		r_z_lists.first[zidx] = nullptr;
+		r_z_lists.last[zidx] = nullptr;
+	}
+	r_z_lists.used.clear();
+}
+
+uint32_t RendererCanvasCull::_add_cull_segment() {
+	if (cull_segment_count == cull_segments.size()) {
+		cull_segments.resize(cull_segment_count + 1);
+	}
+	return cull_segment_count++;
+}
+
+void RendererCanvasCull::_defer_cull_children(Item **p_child_items, int p_child_item_count, bool p_y_sorted, const Transform2D &p_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, Item *p_canvas_clip, Item *p_material_owner, uint32_t p_canvas_cull_mask, const Point2 &p_repeat_size, int p_repeat_times, RendererCanvasRender::Item *p_repeat_source_item) {
+	// Items attached by the tree walk so far are drawn before the chunks.
+	const uint32_t walk_segment = _add_cull_segment();
+	_take_z_lists(z_lists, cull_segments[walk_segment]);
+
+	const int thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	const int chunk_count = CLAMP(p_child_item_count / THREAD_CULL_MIN_CHUNK_SIZE, 1, thread_count * 2);
+	const int chunk_size = Math::division_round_up(p_child_item_count, chunk_count);
+
+	for (int from = 0; from < p_child_item_count; from += chunk_size) {
+		CullChunk chunk;
+		chunk.items = p_child_items + from;
+		chunk.item_count = MIN(chunk_size, p_child_item_count - from);
+		chunk.y_sorted = p_y_sorted;
+		chunk.xform = p_xform;
+		chunk.clip_rect = p_clip_rect;
+		chunk.modulate = p_modulate;
+		chunk.z = p_z;
+		chunk.canvas_clip = p_canvas_clip;
+		chunk.material_owner = p_material_owner;
+		chunk.canvas_cull_mask = p_canvas_cull_mask;
+		chunk.repeat_size = p_repeat_size;
+		chunk.repeat_times = p_repeat_times;
+		chunk.repeat_source_item = p_repeat_source_item;
+		chunk.segment = _add_cull_segment();
+		cull_chunks.push_back(chunk);
+	}
+}
+
+void RendererCanvasCull::_cull_chunk_threaded(uint32_t p_chunk, CullChunk *p_chunks) {
+	const CullChunk &chunk = p_chunks[p_chunk];
+	ZLists &lists = thread_z_lists[WorkerThreadPool::get_thread_index() + 1];
+	FrameAllocator::Scope frame_scope;
+
+	// Same as the children loops of `_cull_canvas_item()`.
+	for (int i = 0; i < chunk.item_count; i++) {
+		Item *child = chunk.items[i];
+		if (chunk.y_sorted) {
+			_cull_canvas_item(child, chunk.xform * child->ysort_xform, chunk.clip_rect, chunk.modulate * child->ysort_modulate, child->ysort_parent_abs_z_index, lists, chunk.canvas_clip, (Item *)child->material_owner, true, chunk.canvas_cull_mask, child->repeat_size, child->repeat_times, child->repeat_source_item);
+		} else if (!child->behind) {
+			_cull_canvas_item(child, chunk.xform, chunk.clip_rect, chunk.modulate, chunk.z, lists, chunk.canvas_clip, chunk.material_owner, false, chunk.canvas_cull_mask, chunk.repeat_size, chunk.repeat_times, chunk.repeat_source_item);
+		}
+	}
+
+	_take_z_lists(lists, cull_segments[chunk.segment]);
+}
+
+void RendererCanvasCull::_cull_deferred_chunks() {
+	// Items attached by the tree walk after the last chunk are drawn last.
+	const uint32_t walk_segment = _add_cull_segment();
+	_take_z_lists(z_lists, cull_segments[walk_segment]);
+
+	const uint32_t thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	for (uint32_t i = thread_z_lists.size(); i < thread_count + 1; i++) {
+		thread_z_lists.push_back(ZLists());
+		thread_z_lists[i].allocate();
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererCanvasCull::_cull_chunk_threaded, cull_chunks.ptr(), cull_chunks.size(), -1, true, SNAME("CullCanvasItems"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Join the segments in traversal order.
+	for (uint32_t i = 0; i < cull_segment_count; i++) {
+		for (const ZListSpan &span : cull_segments[i]) {
+			if (z_lists.last[span.zidx]) {
+				z_lists.last[span.zidx]->next = span.first;
+			} else {
+				z_lists.first[span.zidx] = span.first;
+				z_lists.used.push_back(span.zidx);
+			}
+			z_lists.last[span.zidx] = span.last;
+		}
+		cull_segments[i].clear();
+	}
+
+	cull_segment_count = 0;
+	cull_chunks.clear();
+}
+
+void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *ci, RendererCanvasCull::Item *p_canvas_clip, ZLists &r_z_lists, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &p_modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from) {
 	if (ci->copy_back_buffer) {
 		ci->copy_back_buffer->screen_rect = p_transform.xform(ci->copy_back_buffer->rect).intersection(p_clip_rect);
 	}
@@ -182,7 +462,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		int zidx = p_z - RS::CANVAS_ITEM_Z_MIN;
 		if (r_canvas_group_from == nullptr) {
 			// no list before processing this item, means must put stuff in group from the beginning of list.
-			r_canvas_group_from = r_z_list[zidx];
+			r_canvas_group_from = r_z_lists.first[zidx];
 		} else {
 			// there was a list before processing, so begin group from this one.
 			r_canvas_group_from = r_canvas_group_from->next;
@@ -208,7 +488,9 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 			// If nothing has been drawn, we just take it over and draw it ourselves.
 			if (ci->canvas_group->fit_empty && (ci->commands == nullptr || (ci->commands->next == nullptr && ci->commands->type == RendererCanvasCull::Item::Command::TYPE_RECT && (static_cast<RendererCanvasCull::Item::CommandRect *>(ci->commands)->flags & RendererCanvasRender::CANVAS_RECT_IS_GROUP)))) {
 				// No commands, or sole command is the one used to draw, so we (re)create the draw command.
-				ci->clear();
+				// Canvas groups are never in a cull index, and this may run on a worker thread, so skip
+				// `Item::clear()` and `Item::alloc_command()` which queue index updates.
+				ci->RendererCanvasRender::Item::clear();
 
 				if (rect_accum == Rect2()) {
 					rect_accum.size = Size2(1, 1);
@@ -217,7 +499,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 				rect_accum = rect_accum.grow(ci->canvas_group->fit_margin);
 
 				//draw it?
-				RendererCanvasRender::Item::CommandRect *crect = ci->alloc_command<RendererCanvasRender::Item::CommandRect>();
+				RendererCanvasRender::Item::CommandRect *crect = ci->RendererCanvasRender::Item::alloc_command<RendererCanvasRender::Item::CommandRect>();
 
 				crect->flags = RendererCanvasRender::CANVAS_RECT_IS_GROUP; // so we can recognize it later
 				crect->rect = p_transform.affine_inverse().xform(rect_accum);
@@ -245,7 +527,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		//something to draw?
 
 		if (ci->update_when_visible) {
-			RenderingServerDefault::redraw_request();
+			redraw_requested.set();
 		}
 
 		if (ci->commands != nullptr || ci->copy_back_buffer) {
@@ -257,13 +539,14 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 
 			int zidx = p_z - RS::CANVAS_ITEM_Z_MIN;
 
-			if (r_z_last_list[zidx]) {
-				r_z_last_list[zidx]->next = ci;
-				r_z_last_list[zidx] = ci;
+			if (r_z_lists.last[zidx]) {
+				r_z_lists.last[zidx]->next = ci;
+				r_z_lists.last[zidx] = ci;
 
 			} else {
-				r_z_list[zidx] = ci;
-				r_z_last_list[zidx] = ci;
+				r_z_lists.first[zidx] = ci;
+				r_z_lists.last[zidx] = ci;
+				r_z_lists.used.push_back(zidx);
 			}
 
 			ci->z_final = p_z;
@@ -273,7 +556,9 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 
 		if (ci->visibility_notifier) {
 			if (!ci->visibility_notifier->visible_element.in_list()) {
+				visibility_notifier_lock.lock();
 				visibility_notifier_list.add(&ci->visibility_notifier->visible_element);
+				visibility_notifier_lock.unlock();
 				ci->visibility_notifier->just_visible = true;
 			}
 
@@ -285,7 +570,7 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 	}
 }
 
-void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2D &p_parent_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool p_is_already_y_sorted, uint32_t p_canvas_cull_mask, const Point2 &p_repeat_size, int p_repeat_times, RendererCanvasRender::Item *p_repeat_source_item) {
+void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2D &p_parent_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, ZLists &r_z_lists, Item *p_canvas_clip, Item *p_material_owner, bool p_is_already_y_sorted, uint32_t p_canvas_cull_mask, const Point2 &p_repeat_size, int p_repeat_times, RendererCanvasRender::Item *p_repeat_source_item) {
 	Item *ci = p_canvas_item;
 
 	if (!ci->visible) {
@@ -299,6 +584,9 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	if (ci->children_order_dirty) {
 		ci->child_items.sort_custom<ItemIndexSort>();
 		ci->children_order_dirty = false;
+		if (ci->child_cull_index) {
+			ci->child_cull_index->order_dirty = true;
+		}
 	}
 
 	if (ci->use_parent_material && p_material_owner) {
@@ -414,55 +702,98 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 		if (!p_is_already_y_sorted) {
 			if (ci->ysort_children_count == -1) {
 				ci->ysort_children_count = _count_ysort_children(ci);
+				ci->ysort_items.clear();
 			}
 
 			child_item_count = ci->ysort_children_count + 1;
-			child_items = (Item **)alloca(child_item_count * sizeof(Item *));
+			// While the y-sorted items stay the same, only their keys are collected again and
+			// last frame's order is repaired.
+			const bool keep_order = (int)ci->ysort_items.size() == child_item_count;
+			ci->ysort_items.resize(child_item_count);
+			child_items = ci->ysort_items.ptr();
 
 			ci->ysort_xform = Transform2D();
 			ci->ysort_modulate = Color(1, 1, 1, 1);
 			ci->ysort_index = 0;
 			ci->ysort_parent_abs_z_index = parent_z;
-			child_items[0] = ci;
 			int i = 1;
-			_collect_ysort_children(ci, p_material_owner, Color(1, 1, 1, 1), child_items, i, p_z);
+			if (keep_order) {
+				_collect_ysort_children(ci, p_material_owner, Color(1, 1, 1, 1), nullptr, i, p_z);
+				_repair_ysort_order(child_items, child_item_count);
+			} else {
+				child_items[0] = ci;
+				_collect_ysort_children(ci, p_material_owner, Color(1, 1, 1, 1), child_items, i, p_z);
 
-			SortArray<Item *, ItemYSort> sorter;
-			sorter.sort(child_items, child_item_count);
+				SortArray<Item *, ItemYSort> sorter;
+				sorter.sort(child_items, child_item_count);
+			}
 
-			for (i = 0; i < child_item_count; i++) {
-				_cull_canvas_item(child_items[i], final_xform * child_items[i]->ysort_xform, p_clip_rect, modulate * child_items[i]->ysort_modulate, child_items[i]->ysort_parent_abs_z_index, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, true, p_canvas_cull_mask, child_items[i]->repeat_size, child_items[i]->repeat_times, child_items[i]->repeat_source_item);
+			bool defer = thread_cull_deferring && child_item_count >= thread_cull_threshold;
+			for (i = 0; i < child_item_count && defer; i++) {
+				// Repeated items read the transform of their repeat source, which may be culled in another chunk.
+				defer = !child_items[i]->repeat_source;
+			}
+
+			if (defer) {
+				_defer_cull_children(child_items, child_item_count, true, final_xform, p_clip_rect, modulate, p_z, (Item *)ci->final_clip_owner, nullptr, p_canvas_cull_mask, repeat_size, repeat_times, repeat_source_item);
+			} else {
+				for (i = 0; i < child_item_count; i++) {
+					_cull_canvas_item(child_items[i], final_xform * child_items[i]->ysort_xform, p_clip_rect, modulate * child_items[i]->ysort_modulate, child_items[i]->ysort_parent_abs_z_index, r_z_lists, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, true, p_canvas_cull_mask, child_items[i]->repeat_size, child_items[i]->repeat_times, child_items[i]->repeat_source_item);
+				}
 			}
 		} else {
 			RendererCanvasRender::Item *canvas_group_from = nullptr;
 			bool use_canvas_group = ci->canvas_group != nullptr && (ci->canvas_group->fit_empty || ci->commands != nullptr);
 			if (use_canvas_group) {
 				int zidx = p_z - RS::CANVAS_ITEM_Z_MIN;
-				canvas_group_from = r_z_last_list[zidx];
+				canvas_group_from = r_z_lists.last[zidx];
 			}
 
-			_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_list, r_z_last_list, final_xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from);
+			_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_lists, final_xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from);
 		}
 	} else {
 		RendererCanvasRender::Item *canvas_group_from = nullptr;
 		bool use_canvas_group = ci->canvas_group != nullptr && (ci->canvas_group->fit_empty || ci->commands != nullptr);
 		if (use_canvas_group) {
 			int zidx = p_z - RS::CANVAS_ITEM_Z_MIN;
-			canvas_group_from = r_z_last_list[zidx];
+			canvas_group_from = r_z_lists.last[zidx];
+		}
+
+		// The group is drawn from its children's items in the z lists, which must not be split.
+		// Deferring is only ever enabled on the calling thread, so workers never write the flag.
+		const bool suspend_deferring = use_canvas_group && thread_cull_deferring;
+		if (suspend_deferring) {
+			thread_cull_deferring = false;
+		}
+
+		if (ci->child_cull_index && (!use_cull_index || child_item_count < CULL_INDEX_MIN_CHILDREN / 2)) {
+			_free_child_cull_index(ci);
+		}
+		// Repeated and interpolated children are not where their indexed rect says.
+		if (use_cull_index && child_item_count >= CULL_INDEX_MIN_CHILDREN && !_interpolation_data.interpolation_enabled && !(repeat_source_item && (repeat_size.x || repeat_size.y))) {
+			child_item_count = _cull_index_query(ci, final_xform, p_clip_rect, child_items);
 		}
 
 		for (int i = 0; i < child_item_count; i++) {
 			if (!child_items[i]->behind && !use_canvas_group) {
 				continue;
 			}
-			_cull_canvas_item(child_items[i], final_xform, p_clip_rect, modulate, p_z, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, p_material_owner, false, p_canvas_cull_mask, repeat_size, repeat_times, repeat_source_item);
+			_cull_canvas_item(child_items[i], final_xform, p_clip_rect, modulate, p_z, r_z_lists, (Item *)ci->final_clip_owner, p_material_owner, false, p_canvas_cull_mask, repeat_size, repeat_times, repeat_source_item);
 		}
-		_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_list, r_z_last_list, final_xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from);
-		for (int i = 0; i < child_item_count; i++) {
-			if (child_items[i]->behind || use_canvas_group) {
-				continue;
+		_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_lists, final_xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from);
+		if (thread_cull_deferring && child_item_count >= thread_cull_threshold) {
+			_defer_cull_children(child_items, child_item_count, false, final_xform, p_clip_rect, modulate, p_z, (Item *)ci->final_clip_owner, p_material_owner, p_canvas_cull_mask, repeat_size, repeat_times, repeat_source_item);
+		} else {
+			for (int i = 0; i < child_item_count; i++) {
+				if (child_items[i]->behind || use_canvas_group) {
+					continue;
+				}
+				_cull_canvas_item(child_items[i], final_xform, p_clip_rect, modulate, p_z, r_z_lists, (Item *)ci->final_clip_owner, p_material_owner, false, p_canvas_cull_mask, repeat_size, repeat_times, repeat_source_item);
 			}
-			_cull_canvas_item(child_items[i], final_xform, p_clip_rect, modulate, p_z, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, p_material_owner, false, p_canvas_cull_mask, repeat_size, repeat_times, repeat_source_item);
+		}
+
+		if (suspend_deferring) {
+			thread_cull_deferring = true;
 		}
 	}
 }
@@ -511,6 +842,7 @@ void RendererCanvasCull::canvas_set_item_mirroring(RID p_canvas, RID p_item, con
 	canvas_item->repeat_source_item = is_repeat_source ? canvas_item : nullptr;
 	canvas_item->repeat_size = p_mirroring;
 	canvas_item->repeat_times = 1;
+	_item_cull_bounds_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repeat_size, int p_repeat_times) {
@@ -523,6 +855,7 @@ void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repe
 	canvas_item->repeat_source_item = is_repeat_source ? canvas_item : nullptr;
 	canvas_item->repeat_size = p_repeat_size;
 	canvas_item->repeat_times = p_repeat_times;
+	_item_cull_bounds_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_set_modulate(RID p_canvas, const Color &p_color) {
@@ -567,6 +900,14 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner);
 			}
+
+			if (item_owner->child_cull_index) {
+				_cull_index_remove(item_owner->child_cull_index, canvas_item);
+				item_owner->child_cull_index->order_dirty = true;
+			}
+			if (item_owner->child_items.is_empty()) {
+				_item_cull_bounds_changed(item_owner);
+			}
 		}
 
 		canvas_item->parent = RID();
@@ -588,6 +929,13 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 				_mark_ysort_dirty(item_owner);
 			}
 
+			if (item_owner->child_cull_index) {
+				_cull_index_insert(item_owner->child_cull_index, canvas_item);
+			}
+			if (item_owner->child_items.size() == 1) {
+				_item_cull_bounds_changed(item_owner);
+			}
+
 		} else {
 			ERR_FAIL_MSG("Invalid parent.");
 		}
@@ -626,6 +974,7 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 	}
 
 	canvas_item->xform_curr = p_transform;
+	_item_cull_bounds_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
@@ -663,6 +1012,7 @@ void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_r
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
+	_item_cull_bounds_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_modulate(RID p_item, const Color &p_color) {
@@ -691,6 +1041,7 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->update_when_visible = p_update;
+	_item_cull_bounds_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
@@ -942,7 +1293,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 		pline->primitive = RS::PRIMITIVE_LINE_STRIP;
 
 		if (p_colors.size() == 1 || p_colors.size() == point_count) {
-			pline->polygon.create(indices, p_points, p_colors);
+			canvas_item->create_polygon(pline->polygon, indices, p_points, p_colors);
 		} else {
 			Vector<Color> colors;
 			if (p_colors.is_empty()) {
@@ -957,7 +1308,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 					colors_ptr[i] = color;
 				}
 			}
-			pline->polygon.create(indices, p_points, colors);
+			canvas_item->create_polygon(pline->polygon, indices, p_points, colors);
 		}
 		return;
 	}
@@ -1135,10 +1486,10 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 		}
 
 		pline_left->primitive = RS::PRIMITIVE_TRIANGLE_STRIP;
-		pline_left->polygon.create(indices, points_left, colors_left);
+		canvas_item->create_polygon(pline_left->polygon, indices, points_left, colors_left);
 
 		pline_right->primitive = RS::PRIMITIVE_TRIANGLE_STRIP;
-		pline_right->polygon.create(indices, points_right, colors_right);
+		canvas_item->create_polygon(pline_right->polygon, indices, points_right, colors_right);
 	} else {
 		// Makes a single triangle strip for drawing the line.
 
@@ -1181,7 +1532,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	}
 
 	pline->primitive = RS::PRIMITIVE_TRIANGLE_STRIP;
-	pline->polygon.create(indices, points, colors);
+	canvas_item->create_polygon(pline->polygon, indices, points, colors);
 }
 
 void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, float p_width, bool p_antialiased) {
@@ -1212,7 +1563,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 		Item::CommandPolygon *pline = canvas_item->alloc_command<Item::CommandPolygon>();
 		ERR_FAIL_NULL(pline);
 		pline->primitive = RS::PRIMITIVE_LINES;
-		pline->polygon.create(Vector<int>(), p_points, colors);
+		canvas_item->create_polygon(pline->polygon, Vector<int>(), p_points, colors);
 	} else {
 		if (p_colors.size() == 1) {
 			Color color = p_colors[0];
@@ -1439,7 +1790,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 
 		Vector<Color> color;
 		color.push_back(p_color);
-		circle->polygon.create(indices, points, color);
+		canvas_item->create_polygon(circle->polygon, indices, points, color);
 	}
 
 	if (p_antialiased) {
@@ -1485,7 +1836,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 			colors_ptr[i * 2 + 1] = transparent;
 		}
 
-		feather->polygon.create(indices, points, colors);
+		canvas_item->create_polygon(feather->polygon, indices, points, colors);
 	}
 }
 
@@ -1586,44 +1937,71 @@ void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, con
 	}
 }
 
-void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
-	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
-	ERR_FAIL_NULL(canvas_item);
+void RendererCanvasCull::_set_texture_rect_region(Item::CommandRect *r_rect, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
+	r_rect->modulate = p_modulate;
+	r_rect->rect = p_rect;
 
-	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
-	ERR_FAIL_NULL(rect);
-	rect->modulate = p_modulate;
-	rect->rect = p_rect;
+	r_rect->texture = p_texture;
 
-	rect->texture = p_texture;
-
-	rect->source = p_src_rect;
-	rect->flags = RendererCanvasRender::CANVAS_RECT_REGION;
+	r_rect->source = p_src_rect;
+	r_rect->flags = RendererCanvasRender::CANVAS_RECT_REGION;
 
 	if (p_rect.size.x < 0) {
-		rect->flags |= RendererCanvasRender::CANVAS_RECT_FLIP_H;
-		rect->rect.size.x = -rect->rect.size.x;
+		r_rect->flags |= RendererCanvasRender::CANVAS_RECT_FLIP_H;
+		r_rect->rect.size.x = -r_rect->rect.size.x;
 	}
 	if (p_src_rect.size.x < 0) {
-		rect->flags ^= RendererCanvasRender::CANVAS_RECT_FLIP_H;
-		rect->source.size.x = -rect->source.size.x;
+		r_rect->flags ^= RendererCanvasRender::CANVAS_RECT_FLIP_H;
+		r_rect->source.size.x = -r_rect->source.size.x;
 	}
 	if (p_rect.size.y < 0) {
-		rect->flags |= RendererCanvasRender::CANVAS_RECT_FLIP_V;
-		rect->rect.size.y = -rect->rect.size.y;
+		r_rect->flags |= RendererCanvasRender::CANVAS_RECT_FLIP_V;
+		r_rect->rect.size.y = -r_rect->rect.size.y;
 	}
 	if (p_src_rect.size.y < 0) {
-		rect->flags ^= RendererCanvasRender::CANVAS_RECT_FLIP_V;
-		rect->source.size.y = -rect->source.size.y;
+		r_rect->flags ^= RendererCanvasRender::CANVAS_RECT_FLIP_V;
+		r_rect->source.size.y = -r_rect->source.size.y;
 	}
 
 	if (p_transpose) {
-		rect->flags |= RendererCanvasRender::CANVAS_RECT_TRANSPOSE;
-		SWAP(rect->rect.size.x, rect->rect.size.y);
+		r_rect->flags |= RendererCanvasRender::CANVAS_RECT_TRANSPOSE;
+		SWAP(r_rect->rect.size.x, r_rect->rect.size.y);
 	}
 
 	if (p_clip_uv) {
-		rect->flags |= RendererCanvasRender::CANVAS_RECT_CLIP_UV;
+		r_rect->flags |= RendererCanvasRender::CANVAS_RECT_CLIP_UV;
+	}
+}
+
+void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
+	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
+	ERR_FAIL_NULL(canvas_item);
+
+	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
+	ERR_FAIL_NULL(rect);
+	_set_texture_rect_region(rect, p_rect, p_texture, p_src_rect, p_modulate, p_transpose, p_clip_uv);
+}
+
+void RendererCanvasCull::canvas_item_add_texture_rect_regions(RID p_item, RID p_texture, const Vector<float> &p_rects, const Vector<float> &p_src_rects, const Vector<Color> &p_modulates, bool p_clip_uv) {
+	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
+	ERR_FAIL_NULL(canvas_item);
+	ERR_FAIL_COND_MSG(p_rects.size() % 4 != 0, "Rects must have 4 values (x, y, width, height) per rect.");
+	ERR_FAIL_COND_MSG(p_src_rects.size() != p_rects.size(), "There must be as many source rects as rects.");
+
+	const int rect_count = p_rects.size() / 4;
+	const int modulate_count = p_modulates.size();
+	ERR_FAIL_COND_MSG(modulate_count > 1 && modulate_count != rect_count, "There must be no modulate, a single one, or one per rect.");
+
+	const float *rects = p_rects.ptr();
+	const float *src_rects = p_src_rects.ptr();
+	const Color *modulates = p_modulates.ptr();
+	for (int i = 0; i < rect_count; i++) {
+		Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
+		ERR_FAIL_NULL(rect);
+		const float *r = rects + i * 4;
+		const float *s = src_rects + i * 4;
+		const Color modulate = modulate_count == 0 ? Color(1, 1, 1) : modulates[modulate_count == 1 ? 0 : i];
+		_set_texture_rect_region(rect, Rect2(r[0], r[1], r[2], r[3]), p_texture, Rect2(s[0], s[1], s[2], s[3]), modulate, false, p_clip_uv);
 	}
 }
 
@@ -1695,7 +2073,7 @@ void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2
 	ERR_FAIL_NULL(polygon);
 	polygon->primitive = RS::PRIMITIVE_TRIANGLES;
 	polygon->texture = p_texture;
-	polygon->polygon.create(indices, p_points, p_colors, p_uvs);
+	canvas_item->create_polygon(polygon->polygon, indices, p_points, p_colors, p_uvs);
 }
 
 void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights, RID p_texture, int p_count) {
@@ -1714,7 +2092,7 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 
 	polygon->texture = p_texture;
 
-	polygon->polygon.create(p_indices, p_points, p_colors, p_uvs, p_bones, p_weights);
+	canvas_item->create_polygon(polygon->polygon, p_indices, p_points, p_colors, p_uvs, p_bones, p_weights);
 
 	polygon->primitive = RS::PRIMITIVE_TRIANGLES;
 }
@@ -1825,6 +2203,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 		return;
 	}
 	canvas_item->skeleton = p_skeleton;
+	_item_cull_bounds_changed(canvas_item);
 
 	Item::Command *c = canvas_item->commands;
 
@@ -1862,13 +2241,20 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 		canvas_item->copy_back_buffer->rect = p_rect;
 		canvas_item->copy_back_buffer->full = p_rect == Rect2();
 	}
+	_item_cull_bounds_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
 
+	// The item is usually drawn again right away, often with the same polygons.
+	canvas_item->retain_polygons();
+	if (!canvas_item->retained_polygons.is_empty()) {
+		retained_polygon_items.push_back(p_item);
+	}
 	canvas_item->clear();
+	items_rebuilt++;
 
 #ifdef DEBUG_ENABLED
 	if (debug_redraw) {
@@ -1960,6 +2346,7 @@ void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_
 			canvas_item->visibility_notifier = nullptr;
 		}
 	}
+	_item_cull_bounds_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_debug_redraw(bool p_enabled) {
@@ -1989,6 +2376,7 @@ void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item,
 	ERR_FAIL_NULL(canvas_item);
 	canvas_item->xform_prev = p_transform * canvas_item->xform_prev;
 	canvas_item->xform_curr = p_transform * canvas_item->xform_curr;
+	_item_cull_bounds_changed(canvas_item);
 }
 
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
@@ -2010,6 +2398,7 @@ void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::Canva
 		canvas_item->canvas_group->blur_mipmaps = p_blur_mipmaps;
 		canvas_item->canvas_group->clear_margin = p_clear_margin;
 	}
+	_item_cull_bounds_changed(canvas_item);
 }
 
 RID RendererCanvasCull::canvas_light_allocate() {
@@ -2524,6 +2913,18 @@ void RendererCanvasCull::_update_dirty_item(Item *p_item) {
 
 void RendererCanvasCull::update() {
 	update_dirty_items();
+
+	// Polygons not drawn again since their item was cleared.
+	for (const RID &rid : retained_polygon_items) {
+		Item *canvas_item = canvas_item_owner.get_or_null(rid);
+		if (canvas_item) {
+			canvas_item->free_retained_polygons();
+		}
+	}
+	retained_polygon_items.clear();
+
+	items_rebuilt_in_frame = items_rebuilt;
+	items_rebuilt = 0;
 }
 
 bool RendererCanvasCull::free(RID p_rid) {
@@ -2572,9 +2973,18 @@ bool RendererCanvasCull::free(RID p_rid) {
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner);
 				}
+
+				if (item_owner->child_cull_index) {
+					_cull_index_remove(item_owner->child_cull_index, canvas_item);
+					item_owner->child_cull_index->order_dirty = true;
+				}
+				if (item_owner->child_items.is_empty()) {
+					_item_cull_bounds_changed(item_owner);
+				}
 			}
 		}
 
+		_free_child_cull_index(canvas_item);
 		for (int i = 0; i < canvas_item->child_items.size(); i++) {
 			canvas_item->child_items[i]->parent = RID();
 		}
@@ -2749,17 +3159,20 @@ void RendererCanvasCull::InterpolationData::notify_free_canvas_light_occluder(RI
 RendererCanvasCull::RendererCanvasCull() {
 	_canvas_cull_singleton = this;
 
-	z_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
-	z_last_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+	z_lists.allocate();
 
 	disable_scale = false;
 
 	debug_redraw_time = GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/canvas_items/debug_redraw_time", PROPERTY_HINT_RANGE, "0.1,2,0.001,or_greater"), 1.0);
 	debug_redraw_color = GLOBAL_DEF(PropertyInfo(Variant::COLOR, "debug/canvas_items/debug_redraw_color"), Color(1.0, 0.2, 0.2, 0.5));
+	use_cull_index = GLOBAL_DEF("rendering/2d/culling/use_spatial_index", false);
+	thread_cull_threshold = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/2d/culling/threaded_cull_minimum_children", PROPERTY_HINT_RANGE, "32,65536,1"), 1024);
 }
 
 RendererCanvasCull::~RendererCanvasCull() {
-	memfree(z_list);
-	memfree(z_last_list);
+	z_lists.deallocate();
+	for (ZLists &lists : thread_z_lists) {
+		lists.deallocate();
+	}
 	_canvas_cull_singleton = nullptr;
 }
@@ -31,6 +31,8 @@
 #ifndef RENDERER_CANVAS_CULL_H
 #define RENDERER_CANVAS_CULL_H
 
+#include "core/math/dynamic_bvh.h"
+#include "core/os/spin_lock.h"
 #include "core/templates/paged_allocator.h"
 #include "renderer_compositor.h"
 #include "renderer_viewport.h"
@@ -41,6 +43,8 @@ class RendererCanvasCull {
 	static void _dependency_deleted(const RID &p_dependency, DependencyTracker *p_tracker);
 
 public:
+	struct ChildCullIndex;
+
 	struct Item : public RendererCanvasRender::Item {
 		RID parent; // canvas it belongs to
 		RID self;
@@ -58,6 +62,7 @@ public:
 		Transform2D ysort_xform; // Relative to y-sorted subtree's root item (identity for such root). Its `origin.y` is used for sorting.
 		int ysort_index;
 		int ysort_parent_abs_z_index; // Absolute Z index of parent. Only populated and used when y-sorting.
+		LocalVector<Item *> ysort_items; // Sorted items of a y-sorted subtree, including its root. Kept while `ysort_children_count` is valid.
 		uint32_t visibility_layer = 0xffffffff;
 
 		Vector<Item *> child_items;
@@ -82,8 +87,29 @@ public:
 
 		bool update_dependencies = false;
 
+		// Spatial index of the children, created for items with many of them. See `_cull_index_query()`.
+		ChildCullIndex *child_cull_index = nullptr;
+		// Set while this item is part of its parent's `child_cull_index`, in `cull_index_id` or in the unindexed children.
+		bool in_parent_cull_index = false;
+		DynamicBVH::ID cull_index_id;
+		uint32_t cull_order = 0; // Position in the parent's sorted `child_items`.
+		SelfList<Item> cull_index_update_item;
+
+		// Changing the commands changes the rect used by the parent's `child_cull_index`.
+		template <typename T>
+		T *alloc_command() {
+			_item_cull_bounds_changed(this);
+			return RendererCanvasRender::Item::alloc_command<T>();
+		}
+
+		void clear() {
+			RendererCanvasRender::Item::clear();
+			_item_cull_bounds_changed(this);
+		}
+
 		Item() :
-				update_item(this) {
+				update_item(this),
+				cull_index_update_item(this) {
 			children_order_dirty = true;
 			E = nullptr;
 			z_index = 0;
@@ -107,6 +133,33 @@ public:
 	void _item_queue_update(Item *p_item, bool p_update_dependencies);
 	SelfList<Item>::List _item_update_list;
 
+	// Children of an item are only visited when their rect, in the parent's space, intersects
+	// the clip rect. Children which can't be culled by their own rect are always visited.
+	struct ChildCullIndex {
+		DynamicBVH bvh;
+		LocalVector<Item *> unindexed;
+		bool order_dirty = true;
+	};
+
+	static constexpr int CULL_INDEX_MIN_CHILDREN = 256;
+
+	bool use_cull_index = false;
+	SelfList<Item>::List _cull_index_update_list;
+
+	static void _item_cull_bounds_changed(Item *p_item);
+	bool _is_cull_index_leaf(const Item *p_item) const;
+	void _cull_index_insert(ChildCullIndex *p_index, Item *p_item);
+	void _cull_index_remove(ChildCullIndex *p_index, Item *p_item);
+	void _free_child_cull_index(Item *p_item);
+	void _update_cull_indices();
+	int _cull_index_query(Item *p_canvas_item, const Transform2D &p_xform, const Rect2 &p_clip_rect, Item **&r_child_items);
+
+	struct ItemCullOrderSort {
+		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
+			return p_left->cull_order < p_right->cull_order;
+		}
+	};
+
 	struct ItemIndexSort {
 		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
 			return p_left->index < p_right->index;
@@ -199,23 +252,95 @@ public:
 	double debug_redraw_time = 0;
 	Color debug_redraw_color;
 
+	LocalVector<RID> retained_polygon_items; // Cleared since the last `update()`, see `Item::retain_polygons()`.
+	uint32_t items_rebuilt = 0;
+	uint32_t items_rebuilt_in_frame = 0;
+
 	PagedAllocator<Item::VisibilityNotifierData> visibility_notifier_allocator;
 	SelfList<Item::VisibilityNotifierData>::List visibility_notifier_list;
 
-	_FORCE_INLINE_ void _attach_canvas_item_for_draw(Item *ci, Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from);
+	SpinLock visibility_notifier_lock;
+	SafeFlag redraw_requested;
+
+	static constexpr int z_range = RS::CANVAS_ITEM_Z_MAX - RS::CANVAS_ITEM_Z_MIN + 1;
+
+	// Items to draw for each z index, linked through `RendererCanvasRender::Item::next`.
+	struct ZLists {
+		RendererCanvasRender::Item **first = nullptr;
+		RendererCanvasRender::Item **last = nullptr;
+		LocalVector<uint32_t> used; // Indices of the non-empty lists, so they can be taken without scanning.
+
+		void allocate() {
+			first = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+			last = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+			memset(first, 0, z_range * sizeof(RendererCanvasRender::Item *));
+			memset(last, 0, z_range * sizeof(RendererCanvasRender::Item *));
+		}
+
+		void deallocate() {
+			memfree(first);
+			memfree(last);
+			first = nullptr;
+			last = nullptr;
+		}
+	};
+
+	static void _set_texture_rect_region(Item::CommandRect *r_rect, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv);
+
+	_FORCE_INLINE_ void _attach_canvas_item_for_draw(Item *ci, Item *p_canvas_clip, ZLists &r_z_lists, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from);
 
 private:
 	void _render_canvas_item_tree(RID p_to_render_target, Canvas::ChildItem *p_child_items, int p_child_item_count, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, uint32_t p_canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info = nullptr);
-	void _cull_canvas_item(Item *p_canvas_item, const Transform2D &p_parent_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool p_is_already_y_sorted, uint32_t p_canvas_cull_mask, const Point2 &p_repeat_size, int p_repeat_times, RendererCanvasRender::Item *p_repeat_source_item);
+	void _cull_canvas_item(Item *p_canvas_item, const Transform2D &p_parent_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, ZLists &r_z_lists, Item *p_canvas_clip, Item *p_material_owner, bool p_is_already_y_sorted, uint32_t p_canvas_cull_mask, const Point2 &p_repeat_size, int p_repeat_times, RendererCanvasRender::Item *p_repeat_source_item);
 
 	void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int p_z);
 	int _count_ysort_children(RendererCanvasCull::Item *p_canvas_item);
+	void _repair_ysort_order(RendererCanvasCull::Item **p_items, int p_item_count);
+	static constexpr int YSORT_REPAIR_MOVES_PER_ITEM = 8;
 	void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner);
 
-	static constexpr int z_range = RS::CANVAS_ITEM_Z_MAX - RS::CANVAS_ITEM_Z_MIN + 1;
+	ZLists z_lists;
 
-	RendererCanvasRender::Item **z_list;
-	RendererCanvasRender::Item **z_last_list;
+	// Threaded culling. Long child lists met while walking the tree are split into chunks, which are
+	// culled on worker threads after the walk. Each chunk, and each part of the walk between chunks,
+	// fills its own segment of z lists; segments are joined in traversal order to keep the draw order.
+	struct ZListSpan {
+		uint32_t zidx = 0;
+		RendererCanvasRender::Item *first = nullptr;
+		RendererCanvasRender::Item *last = nullptr;
+	};
+
+	struct CullChunk {
+		Item **items = nullptr; // Frame allocated or the parent's `child_items`, alive until the chunks are culled.
+		int item_count = 0;
+		bool y_sorted = false;
+		Transform2D xform;
+		Rect2 clip_rect;
+		Color modulate;
+		int z = 0;
+		Item *canvas_clip = nullptr;
+		Item *material_owner = nullptr;
+		uint32_t canvas_cull_mask = 0;
+		Point2 repeat_size;
+		int repeat_times = 1;
+		RendererCanvasRender::Item *repeat_source_item = nullptr;
+		uint32_t segment = 0;
+	};
+
+	static constexpr int THREAD_CULL_MIN_CHUNK_SIZE = 64;
+
+	int thread_cull_threshold = 1024;
+	bool thread_cull_deferring = false; // Only while walking the tree on the calling thread.
+	LocalVector<CullChunk> cull_chunks;
+	LocalVector<LocalVector<ZListSpan>> cull_segments; // Not shrunk, to keep the spans' memory.
+	uint32_t cull_segment_count = 0;
+	LocalVector<ZLists> thread_z_lists; // Indexed by worker thread index + 1, the calling thread comes first.
+
+	void _take_z_lists(ZLists &r_z_lists, LocalVector<ZListSpan> &r_spans);
+	uint32_t _add_cull_segment();
+	void _defer_cull_children(Item **p_child_items, int p_child_item_count, bool p_y_sorted, const Transform2D &p_xform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, Item *p_canvas_clip, Item *p_material_owner, uint32_t p_canvas_cull_mask, const Point2 &p_repeat_size, int p_repeat_times, RendererCanvasRender::Item *p_repeat_source_item);
+	void _cull_chunk_threaded(uint32_t p_chunk, CullChunk *p_chunks);
+	void _cull_deferred_chunks();
 
 public:
 	void render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t p_canvas_cull_mask, RenderingMethod::RenderInfo *r_render_info = nullptr);
@@ -260,6 +385,7 @@ public:
 	void canvas_item_add_circle(RID p_item, const Point2 &p_pos, float p_radius, const Color &p_color, bool p_antialiased);
 	void canvas_item_add_texture_rect(RID p_item, const Rect2 &p_rect, RID p_texture, bool p_tile = false, const Color &p_modulate = Color(1, 1, 1), bool p_transpose = false);
 	void canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate = Color(1, 1, 1), bool p_transpose = false, bool p_clip_uv = false);
+	void canvas_item_add_texture_rect_regions(RID p_item, RID p_texture, const Vector<float> &p_rects, const Vector<float> &p_src_rects, const Vector<Color> &p_modulates = Vector<Color>(), bool p_clip_uv = false);
 	void canvas_item_add_msdf_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate = Color(1, 1, 1), int p_outline_size = 0, float p_px_range = 1.0, float p_scale = 1.0);
 	void canvas_item_add_lcd_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate = Color(1, 1, 1));
 	void canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, RS::NinePatchAxisMode p_x_axis_mode = RS::NINE_PATCH_STRETCH, RS::NinePatchAxisMode p_y_axis_mode = RS::NINE_PATCH_STRETCH, bool p_draw_center = true, const Color &p_modulate = Color(1, 1, 1));
@@ -386,6 +512,13 @@ public:
 	void update_interpolation_tick(bool p_process = true);
 	void set_physics_interpolation_enabled(bool p_enabled) { _interpolation_data.interpolation_enabled = p_enabled; }
 
+	void set_use_cull_index(bool p_enabled) { use_cull_index = p_enabled; }
+	bool is_using_cull_index() const { return use_cull_index; }
+	void set_thread_cull_threshold(int p_threshold) { thread_cull_threshold = p_threshold; }
+	int get_thread_cull_threshold() const { return thread_cull_threshold; }
+
+	uint32_t get_items_rebuilt_in_frame() const { return items_rebuilt_in_frame; }
+
 	struct InterpolationData {
 		void notify_free_canvas_item(RID p_rid, RendererCanvasCull::Item &r_canvas_item);
 		void notify_free_canvas_light(RID p_rid, RendererCanvasRender::Light &r_canvas_light);
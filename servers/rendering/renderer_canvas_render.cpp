@@ -131,6 +131,103 @@ const Rect2 &RendererCanvasRender::Item::get_rect() const {
 	return rect;
 }
 
+template <typename T>
+static bool _polygon_arrays_equal(const Vector<T> &p_a, const Vector<T> &p_b) {
+	// Bitwise, as that is what is uploaded to the renderer.
+	if (p_a.size() != p_b.size()) {
+		return false;
+	}
+	return p_a.ptr() == p_b.ptr() || memcmp(p_a.ptr(), p_b.ptr(), p_a.size() * sizeof(T)) == 0;
+}
+
+bool RendererCanvasRender::PolygonData::matches(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights) const {
+	return _polygon_arrays_equal(indices, p_indices) && _polygon_arrays_equal(points, p_points) && _polygon_arrays_equal(colors, p_colors) && _polygon_arrays_equal(uvs, p_uvs) && _polygon_arrays_equal(bones, p_bones) && _polygon_arrays_equal(weights, p_weights);
+}
+
+uint64_t RendererCanvasRender::Item::hash_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights) {
+	// Two 32-bit hashes with different seeds, so that retained polygons rarely need their data compared.
+	uint32_t h1 = HASH_MURMUR3_SEED;
+	uint32_t h2 = hash_murmur3_one_32(HASH_MURMUR3_SEED);
+	const auto hash_data = [&](const void *p_data, int p_size) {
+		h1 = hash_murmur3_buffer(p_data, p_size, hash_murmur3_one_32(p_size, h1));
+		h2 = hash_murmur3_buffer(p_data, p_size, hash_murmur3_one_32(p_size, h2));
+	};
+	hash_data(p_indices.ptr(), p_indices.size() * sizeof(int));
+	hash_data(p_points.ptr(), p_points.size() * sizeof(Point2));
+	hash_data(p_colors.ptr(), p_colors.size() * sizeof(Color));
+	hash_data(p_uvs.ptr(), p_uvs.size() * sizeof(Point2));
+	hash_data(p_bones.ptr(), p_bones.size() * sizeof(int));
+	hash_data(p_weights.ptr(), p_weights.size() * sizeof(float));
+	return (uint64_t(h1) << 32) | h2;
+}
+
+void RendererCanvasRender::Item::create_polygon(Polygon &r_polygon, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights) {
+	ERR_FAIL_COND(r_polygon.polygon_id != 0);
+	const uint64_t hash = hash_polygon(p_indices, p_points, p_colors, p_uvs, p_bones, p_weights);
+
+	// Polygons are usually drawn again in the same order, so start after the last one reused.
+	const uint32_t retained_count = retained_polygons.size();
+	for (uint32_t i = 0; i < retained_count; i++) {
+		const uint32_t index = (retained_polygon_hint + i) % retained_count;
+		RetainedPolygon &retained = retained_polygons[index];
+		if (retained.polygon_id == 0 || retained.hash != hash || !retained.data.matches(p_indices, p_points, p_colors, p_uvs, p_bones, p_weights)) {
+			continue;
+		}
+
+		r_polygon.polygon_id = retained.polygon_id;
+		r_polygon.rect_cache = retained.rect_cache;
+		r_polygon.hash = hash;
+		r_polygon.data = retained.data;
+		retained.polygon_id = 0;
+		retained.data = PolygonData();
+		retained_polygon_hint = index + 1;
+		return;
+	}
+
+	r_polygon.create(p_indices, p_points, p_colors, p_uvs, p_bones, p_weights);
+	r_polygon.hash = hash;
+	r_polygon.data.indices = p_indices;
+	r_polygon.data.points = p_points;
+	r_polygon.data.colors = p_colors;
+	r_polygon.data.uvs = p_uvs;
+	r_polygon.data.bones = p_bones;
+	r_polygon.data.weights = p_weights;
+}
+
+void RendererCanvasRender::Item::retain_polygons() {
+	// Polygons retained before and not reused since are not drawn anymore.
+	free_retained_polygons();
+
+	for (Command *c = commands; c; c = c->next) {
+		if (c->type != Command::TYPE_POLYGON) {
+			continue;
+		}
+		Polygon &polygon = static_cast<CommandPolygon *>(c)->polygon;
+		if (polygon.polygon_id == 0 || polygon.hash == 0) {
+			continue;
+		}
+
+		RetainedPolygon retained;
+		retained.hash = polygon.hash;
+		retained.polygon_id = polygon.polygon_id;
+		retained.rect_cache = polygon.rect_cache;
+		retained.data = polygon.data;
+		retained_polygons.push_back(retained);
+		polygon.polygon_id = 0;
+		polygon.data = PolygonData();
+	}
+}
+
+void RendererCanvasRender::Item::free_retained_polygons() {
+	for (const RetainedPolygon &retained : retained_polygons) {
+		if (retained.polygon_id) {
+			singleton->free_polygon(retained.polygon_id);
+		}
+	}
+	retained_polygons.clear();
+	retained_polygon_hint = 0;
+}
+
 RendererCanvasRender::Item::CommandMesh::~CommandMesh() {
 	if (mesh_instance.is_valid()) {
 		RSG::mesh_storage->mesh_instance_free(mesh_instance);
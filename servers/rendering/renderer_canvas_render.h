@@ -134,10 +134,24 @@ public:
 	virtual PolygonID request_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs = Vector<Point2>(), const Vector<int> &p_bones = Vector<int>(), const Vector<float> &p_weights = Vector<float>()) = 0;
 	virtual void free_polygon(PolygonID p_polygon) = 0;
 
+	// The arrays a polygon was created from. They are copy on write, so keeping them only shares the caller's data.
+	struct PolygonData {
+		Vector<int> indices;
+		Vector<Point2> points;
+		Vector<Color> colors;
+		Vector<Point2> uvs;
+		Vector<int> bones;
+		Vector<float> weights;
+
+		bool matches(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights) const;
+	};
+
 	//also easier to wrap to avoid mistakes
 	struct Polygon {
 		PolygonID polygon_id;
 		Rect2 rect_cache;
+		uint64_t hash = 0; // Of the polygon's data, set when created by `Item::create_polygon()`.
+		PolygonData data; // Set with `hash`, to compare exactly before reusing the polygon.
 
 		_FORCE_INLINE_ void create(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs = Vector<Point2>(), const Vector<int> &p_bones = Vector<int>(), const Vector<float> &p_weights = Vector<float>()) {
 			ERR_FAIL_COND(polygon_id != 0);
@@ -374,6 +388,23 @@ public:
 		Command *last_command = nullptr;
 		Vector<CommandBlock> blocks;
 		uint32_t current_block;
+
+		// Polygons taken from the commands by `retain_polygons()`, reused by `create_polygon()` when the
+		// item draws the same polygon again. Items are often redrawn without changes, and creating a
+		// polygon uploads new buffers to the renderer.
+		struct RetainedPolygon {
+			uint64_t hash = 0;
+			PolygonID polygon_id = 0;
+			Rect2 rect_cache;
+			PolygonData data;
+		};
+		LocalVector<RetainedPolygon> retained_polygons;
+		uint32_t retained_polygon_hint = 0;
+
+		static uint64_t hash_polygon(const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights);
+		void create_polygon(Polygon &r_polygon, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs = Vector<Point2>(), const Vector<int> &p_bones = Vector<int>(), const Vector<float> &p_weights = Vector<float>());
+		void retain_polygons();
+		void free_retained_polygons();
 #ifdef DEBUG_ENABLED
 		mutable double debug_redraw_time = 0;
 #endif
@@ -489,6 +520,7 @@ public:
 		}
 		virtual ~Item() {
 			clear();
+			free_retained_polygons();
 			for (int i = 0; i < blocks.size(); i++) {
 				memfree(blocks[i].memory);
 			}
@@ -32,6 +32,7 @@
 #define TEST_JSON_H
 
 #include "core/io/json.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -317,6 +318,172 @@ TEST_CASE("[JSON] Serialization") {
 		}
 	}
 }
+
+TEST_CASE("[JSON] Serialization of nested structures") {
+	Dictionary inner;
+	inner["b"] = 1;
+	inner["a"] = Array();
+	Array array;
+	array.push_back("x");
+	array.push_back(inner);
+	Dictionary outer;
+	outer["list"] = array;
+	outer["empty"] = Dictionary();
+
+	CHECK(JSON::stringify(outer) == "{\"empty\":{},\"list\":[\"x\",{\"a\":[],\"b\":1}]}");
+	CHECK(JSON::stringify(outer, "\t") == "{\n\t\"empty\": {\n\n\t},\n\t\"list\": [\n\t\t\"x\",\n\t\t{\n\t\t\t\"a\": [],\n\t\t\t\"b\": 1\n\t\t}\n\t]\n}");
+	CHECK(JSON::parse_string(JSON::stringify(outer, "  ")) == Variant(outer));
+
+	ERR_PRINT_OFF
+	Array circular;
+	circular.push_back(circular);
+	CHECK(JSON::stringify(circular) == "[\"[...]\"]");
+	circular.clear();
+	ERR_PRINT_ON
+}
+
+TEST_CASE("[JSON] Parsing long strings") {
+	String text;
+	for (int i = 0; i < 10000; i++) {
+		text += String::num_int64(i) + (i % 100 == 0 ? "\n\"\\" : String::utf8(" ü "));
+	}
+
+	JSON json;
+	CHECK(json.parse(JSON::stringify(text)) == OK);
+	CHECK(json.get_data() == Variant(text));
+
+	// Newlines inside strings count for the error line, which starts at 0.
+	CHECK(json.parse("[\"a\nb\nc\", x]") == ERR_PARSE_ERROR);
+	CHECK(json.get_error_line() == 2);
+}
+
+TEST_CASE("[JSON] Parsing UTF-8") {
+	String text;
+	for (int i = 0; i < 1000; i++) {
+		text += String::num_int64(i) + (i % 100 == 0 ? "\n\"\\" : String::utf8(" ü € 😀 "));
+	}
+	Dictionary dict;
+	dict["text"] = text;
+	Array values;
+	values.push_back(1.5);
+	values.push_back(-2);
+	values.push_back(true);
+	values.push_back(Variant());
+	values.push_back(String::utf8("\u00e9"));
+	dict[String::utf8("ключ")] = values;
+	const String json_text = JSON::stringify(dict, "\t");
+
+	JSON from_string;
+	REQUIRE(from_string.parse(json_text) == OK);
+
+	// Also make sure the parser doesn't read past the end of a buffer that isn't null terminated.
+	CharString utf8 = json_text.utf8();
+	Vector<uint8_t> bytes;
+	bytes.resize(utf8.length() + 1);
+	memcpy(bytes.ptrw(), utf8.get_data(), utf8.length());
+	bytes.write[utf8.length()] = ']';
+
+	JSON from_utf8;
+	CHECK(from_utf8.parse_utf8(bytes.ptr(), utf8.length()) == OK);
+	CHECK(from_utf8.get_data() == from_string.get_data());
+
+	CHECK(from_utf8.parse_utf8(bytes.ptr(), bytes.size()) == ERR_PARSE_ERROR);
+	CHECK(from_utf8.get_error_message() == "Expected 'EOF'");
+
+	const char *invalid = "{\n\"a\": [1,\n2 3]}";
+	CHECK(from_string.parse(invalid) == ERR_PARSE_ERROR);
+	CHECK(from_utf8.parse_utf8((const uint8_t *)invalid, strlen(invalid)) == ERR_PARSE_ERROR);
+	CHECK(from_utf8.get_error_line() == from_string.get_error_line());
+	CHECK(from_utf8.get_error_message() == from_string.get_error_message());
+
+	// Byte order marks are skipped.
+	const char *with_bom = "\xef\xbb\xbf[1]";
+	CHECK(from_utf8.parse_utf8((const uint8_t *)with_bom, strlen(with_bom)) == OK);
+	CHECK(from_utf8.get_data() == JSON::parse_string("[1]"));
+}
+
+class TestJSONListener : public JSON::ParseListener {
+public:
+	PackedStringArray events;
+	int stop_at = -1;
+
+	Error _add(const String &p_event) {
+		if (events.size() == stop_at) {
+			return ERR_SKIP;
+		}
+		events.push_back(p_event);
+		return OK;
+	}
+
+	virtual Error begin_object() override { return _add("{"); }
+	virtual Error end_object() override { return _add("}"); }
+	virtual Error begin_array() override { return _add("["); }
+	virtual Error end_array() override { return _add("]"); }
+	virtual Error object_key(const String &p_key) override { return _add(p_key + ":"); }
+	virtual Error value(const Variant &p_value) override { return _add(p_value.get_type() == Variant::NIL ? "null" : String(p_value)); }
+};
+
+TEST_CASE("[JSON] Parsing with a listener") {
+	const String json_text = "{\"a\": [1, \"two\", null], \"b\": {\"c\": true}}";
+	const String expected = "{,a:,[,1.0,two,null,],b:,{,c:,true,},}";
+
+	TestJSONListener listener;
+	CHECK(JSON::parse_events(json_text, listener) == OK);
+	CHECK(String(",").join(listener.events) == expected);
+
+	TestJSONListener utf8_listener;
+	CharString utf8 = json_text.utf8();
+	CHECK(JSON::parse_utf8_events((const uint8_t *)utf8.get_data(), utf8.length(), utf8_listener) == OK);
+	CHECK(String(",").join(utf8_listener.events) == expected);
+
+	// Returning an error stops parsing.
+	TestJSONListener stopping_listener;
+	stopping_listener.stop_at = 3;
+	String err_str;
+	CHECK(JSON::parse_events(json_text, stopping_listener, &err_str) == ERR_SKIP);
+	CHECK(stopping_listener.events.size() == 3);
+	CHECK(!err_str.is_empty());
+
+	TestJSONListener failing_listener;
+	int err_line = -1;
+	CHECK(JSON::parse_events("[1,\n2,\n{]", failing_listener, &err_str, &err_line) == ERR_PARSE_ERROR);
+	CHECK(err_line == 2);
+	CHECK(err_str == "Expected key");
+}
+
+TEST_CASE_PENDING("[JSON] Benchmark UTF-8 parsing") {
+	Array rows;
+	for (int i = 0; i < 100000; i++) {
+		Dictionary row;
+		row["id"] = i;
+		row["name"] = String::utf8("entry ü ") + itos(i);
+		Array values;
+		values.push_back(i * 0.5);
+		values.push_back(i % 7 == 0);
+		values.push_back(Variant());
+		row["values"] = values;
+		rows.push_back(row);
+	}
+	const String json_text = JSON::stringify(rows);
+	const CharString utf8 = json_text.utf8();
+
+	JSON json;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	String decoded = String::utf8(utf8.get_data(), utf8.length());
+	CHECK(json.parse(decoded) == OK);
+	const uint64_t string_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	CHECK(json.parse_utf8((const uint8_t *)utf8.get_data(), utf8.length()) == OK);
+	const uint64_t utf8_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	JSON::ParseListener listener;
+	begin = OS::get_singleton()->get_ticks_usec();
+	CHECK(JSON::parse_utf8_events((const uint8_t *)utf8.get_data(), utf8.length(), listener) == OK);
+	const uint64_t events_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Parsing %d bytes: decode + parse %d usec, parse_utf8 %d usec, parse_utf8_events %d usec.", utf8.length(), string_usec, utf8_usec, events_usec));
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -31,10 +31,13 @@
 #ifndef TEST_RESOURCE_H
 #define TEST_RESOURCE_H
 
+#include "core/io/image.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/variant/variant_parser.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -166,6 +169,278 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Loading big text resources") {
+	// Big enough for the parser to go through many refills of its readahead buffer.
+	const int count = 100000;
+	PackedFloat32Array floats;
+	PackedInt32Array ints;
+	PackedByteArray bytes;
+	PackedVector2Array vectors;
+	floats.resize(count);
+	ints.resize(count);
+	bytes.resize(count);
+	vectors.resize(count);
+	for (int i = 0; i < count; i++) {
+		floats.set(i, i * 0.25f - 1000.5f);
+		ints.set(i, (i % 2) ? i : -i);
+		bytes.set(i, i % 256);
+		vectors.set(i, Vector2(i, -i * 0.5f));
+	}
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_meta("floats", floats);
+	resource->set_meta("ints", ints);
+	resource->set_meta("bytes", bytes);
+	resource->set_meta("vectors", vectors);
+	const String save_path_text = TestUtils::get_temp_path("big_resource.tres");
+	ResourceSaver::save(resource, save_path_text);
+
+	const Ref<Resource> loaded = ResourceLoader::load(save_path_text, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_meta("floats") == Variant(floats));
+	CHECK(loaded->get_meta("ints") == Variant(ints));
+	CHECK(loaded->get_meta("bytes") == Variant(bytes));
+	CHECK(loaded->get_meta("vectors") == Variant(vectors));
+
+	// Parsing from memory must give the same result as reading the file one character at a time.
+	Dictionary dict;
+	dict["floats"] = floats;
+	dict["vectors"] = vectors;
+	dict["string"] = String::utf8("Unicode: ßæ€ \"quoted\"\n");
+	String text;
+	VariantWriter::write_to_string(dict, text);
+	const String save_path_value = TestUtils::get_temp_path("big_value.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(save_path_value, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(text);
+	}
+
+	Variant from_file;
+	{
+		VariantParser::StreamFile stream(false);
+		stream.f = FileAccess::open(save_path_value, FileAccess::READ);
+		String err_str;
+		int err_line = 0;
+		CHECK(VariantParser::parse(&stream, from_file, err_str, err_line) == OK);
+	}
+
+	Variant from_buffer;
+	{
+		VariantParser::StreamBuffer stream;
+		stream.set_data(FileAccess::get_file_as_bytes(save_path_value));
+		String err_str;
+		int err_line = 0;
+		CHECK(VariantParser::parse(&stream, from_buffer, err_str, err_line) == OK);
+		CHECK(stream.get_position() == uint64_t(text.utf8().length()));
+	}
+
+	CHECK(from_file == Variant(dict));
+	CHECK(from_buffer == from_file);
+}
+
+TEST_CASE_PENDING("[Resource] Benchmark parsing text from a file and from memory") {
+	const int count = 1000000;
+	PackedFloat32Array floats;
+	floats.resize(count);
+	for (int i = 0; i < count; i++) {
+		floats.set(i, i * 0.25f - 1000.5f);
+	}
+	String text;
+	VariantWriter::write_to_string(floats, text);
+	const String save_path = TestUtils::get_temp_path("benchmark_value.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(save_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(text);
+	}
+
+	// One single-byte FileAccess read per character, as text resources used to be loaded.
+	Variant from_file;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	{
+		VariantParser::StreamFile stream(false);
+		stream.f = FileAccess::open(save_path, FileAccess::READ);
+		String err_str;
+		int err_line = 0;
+		CHECK(VariantParser::parse(&stream, from_file, err_str, err_line) == OK);
+	}
+	const uint64_t file_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	// Reading the whole file first is part of the cost.
+	Variant from_buffer;
+	begin = OS::get_singleton()->get_ticks_usec();
+	{
+		VariantParser::StreamBuffer stream;
+		stream.set_data(FileAccess::get_file_as_bytes(save_path));
+		String err_str;
+		int err_line = 0;
+		CHECK(VariantParser::parse(&stream, from_buffer, err_str, err_line) == OK);
+	}
+	const uint64_t buffer_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(from_buffer == from_file);
+
+	MESSAGE(vformat("Parsing %d characters: StreamFile without readahead %d usec, StreamBuffer %d usec.", text.length(), file_usec, buffer_usec));
+}
+
+static SafeFlag pool_blockers_exit;
+
+static void pool_blocker_task(void *p_arg) {
+	while (!pool_blockers_exit.is_set()) {
+		OS::get_singleton()->delay_usec(100);
+	}
+}
+
+// Keeps every thread the pool allows for low priority tasks busy, with further ones queued.
+static LocalVector<WorkerThreadPool::TaskID> saturate_low_priority_pool() {
+	pool_blockers_exit.clear();
+	LocalVector<WorkerThreadPool::TaskID> blockers;
+	for (int i = 0; i < WorkerThreadPool::get_singleton()->get_thread_count(); i++) {
+		blockers.push_back(WorkerThreadPool::get_singleton()->add_native_task(&pool_blocker_task, nullptr, false));
+	}
+	return blockers;
+}
+
+static void release_pool(const LocalVector<WorkerThreadPool::TaskID> &p_blockers) {
+	pool_blockers_exit.set();
+	for (WorkerThreadPool::TaskID blocker : p_blockers) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(blocker);
+	}
+}
+
+TEST_CASE("[Resource] Threaded loading priority") {
+	if (WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		return; // Some thread must stay free of low priority tasks.
+	}
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Hello world");
+	const String save_path_normal = TestUtils::get_temp_path("resource_normal_priority.res");
+	const String save_path_high = TestUtils::get_temp_path("resource_high_priority.res");
+	ResourceSaver::save(resource, save_path_normal);
+	ResourceSaver::save(resource, save_path_high);
+
+	LocalVector<WorkerThreadPool::TaskID> blockers = saturate_low_priority_pool();
+
+	CHECK(ResourceLoader::load_threaded_request(save_path_normal, "", false, ResourceFormatLoader::CACHE_MODE_IGNORE) == OK);
+	CHECK(ResourceLoader::load_threaded_request(save_path_high, "", false, ResourceFormatLoader::CACHE_MODE_IGNORE, ResourceLoader::LOAD_PRIORITY_HIGH) == OK);
+
+	Ref<Resource> loaded_high = ResourceLoader::load_threaded_get(save_path_high);
+	CHECK_MESSAGE(
+			loaded_high.is_valid(),
+			"The high priority load should complete while the pool is saturated with low priority tasks.");
+	CHECK_MESSAGE(
+			ResourceLoader::load_threaded_get_status(save_path_normal) == ResourceLoader::THREAD_LOAD_IN_PROGRESS,
+			"The normal priority load should still be queued behind the low priority tasks.");
+
+	release_pool(blockers);
+
+	Ref<Resource> loaded_normal = ResourceLoader::load_threaded_get(save_path_normal);
+	CHECK_MESSAGE(
+			loaded_normal.is_valid(),
+			"The normal priority load should complete once the pool is released.");
+	CHECK(loaded_normal->get_name() == "Hello world");
+}
+
+TEST_CASE("[Resource] Threaded loading cancellation") {
+	if (WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		return;
+	}
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Hello world");
+	const String save_path = TestUtils::get_temp_path("resource_cancelled.res");
+	ResourceSaver::save(resource, save_path);
+
+	LocalVector<WorkerThreadPool::TaskID> blockers = saturate_low_priority_pool();
+
+	CHECK(ResourceLoader::load_threaded_request(save_path, "", false, ResourceFormatLoader::CACHE_MODE_IGNORE) == OK);
+	CHECK(ResourceLoader::load_threaded_cancel(save_path) == OK);
+	CHECK_MESSAGE(
+			ResourceLoader::load_threaded_get_status(save_path) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE,
+			"A cancelled load should not be tracked anymore.");
+	CHECK_MESSAGE(
+			ResourceLoader::load_threaded_cancel(save_path) == ERR_INVALID_PARAMETER,
+			"Cancelling twice should fail.");
+
+	release_pool(blockers);
+
+	// Requesting again must work, no matter how far the cancelled load went.
+	CHECK(ResourceLoader::load_threaded_request(save_path, "", false, ResourceFormatLoader::CACHE_MODE_IGNORE) == OK);
+	Ref<Resource> loaded = ResourceLoader::load_threaded_get(save_path);
+	CHECK(loaded.is_valid());
+	CHECK(loaded->get_name() == "Hello world");
+}
+
+TEST_CASE("[Resource] Threaded loading cancellation with cache reuse") {
+	if (WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		return;
+	}
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Hello world");
+	const String save_path = TestUtils::get_temp_path("resource_cancelled_reuse.res");
+	ResourceSaver::save(resource, save_path);
+
+	LocalVector<WorkerThreadPool::TaskID> blockers = saturate_low_priority_pool();
+
+	// The cancelled load is still queued when it's requested again, so it must not be revived.
+	CHECK(ResourceLoader::load_threaded_request(save_path, "", false, ResourceFormatLoader::CACHE_MODE_REUSE) == OK);
+	CHECK(ResourceLoader::load_threaded_cancel(save_path) == OK);
+	CHECK(ResourceLoader::load_threaded_request(save_path, "", false, ResourceFormatLoader::CACHE_MODE_REUSE) == OK);
+	CHECK(ResourceLoader::load_threaded_get_status(save_path) == ResourceLoader::THREAD_LOAD_IN_PROGRESS);
+
+	release_pool(blockers);
+
+	Error err = FAILED;
+	Ref<Resource> loaded = ResourceLoader::load_threaded_get(save_path, &err);
+	CHECK_MESSAGE(
+			err == OK,
+			"The new request should not inherit the result of the cancelled load.");
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Hello world");
+}
+
+TEST_CASE("[Resource] Soft cache eviction") {
+	const uint64_t image_size = Image::get_image_data_size(64, 64, Image::FORMAT_RGBA8, false);
+	ResourceCache::set_soft_cache_budget(image_size * 5 / 2);
+
+	const String paths[3] = { "res://soft_cache_a.res", "res://soft_cache_b.res", "res://soft_cache_c.res" };
+	for (const String &path : paths) {
+		Ref<Image> image = Image::create_empty(64, 64, false, Image::FORMAT_RGBA8);
+		CHECK(image->get_memory_usage() == image_size);
+		image->set_path(path);
+		ResourceCache::soft_cache_retain(image);
+	}
+
+	CHECK_MESSAGE(
+			!ResourceCache::has(paths[0]),
+			"The least recently used resource should be evicted once the budget is exceeded.");
+	CHECK(ResourceCache::has(paths[1]));
+	CHECK(ResourceCache::has(paths[2]));
+	CHECK(ResourceCache::get_soft_cache_memory_usage() == image_size * 2);
+
+	// Touching a resource makes it the most recently used one.
+	Ref<Resource> touched = ResourceCache::get_ref(paths[1]);
+	CHECK(touched.is_valid());
+	touched.unref();
+	Ref<Image> image = Image::create_empty(64, 64, false, Image::FORMAT_RGBA8);
+	image->set_path(paths[0]);
+	ResourceCache::soft_cache_retain(image);
+	image.unref();
+
+	CHECK(ResourceCache::has(paths[0]));
+	CHECK(ResourceCache::has(paths[1]));
+	CHECK(!ResourceCache::has(paths[2]));
+
+	ResourceCache::soft_cache_clear();
+	CHECK(ResourceCache::get_soft_cache_memory_usage() == 0);
+	CHECK(!ResourceCache::has(paths[0]));
+	CHECK(!ResourceCache::has(paths[1]));
+	ResourceCache::set_soft_cache_budget(0);
+}
+
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
@@ -34,6 +34,8 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 
 #include "tests/test_macros.h"
 
@@ -224,6 +226,47 @@ TEST_CASE("[Object] Construction") {
 			"The database pointer returned by the object id should reference same object.");
 }
 
+TEST_CASE("[Object] Instance lookup while other threads add and remove instances") {
+	Object persistent;
+
+	struct Tester {
+		ObjectID persistent_id;
+		Object *persistent = nullptr;
+		SafeFlag failed;
+		Thread threads[4];
+	} tester;
+	tester.persistent_id = persistent.get_instance_id();
+	tester.persistent = &persistent;
+
+	const int count_before = ObjectDB::get_object_count();
+
+	for (Thread &thread : tester.threads) {
+		thread.start(
+				[](void *p_data) {
+					Tester *t = (Tester *)p_data;
+					for (int i = 0; i < 2000; i++) {
+						Object *object = memnew(Object);
+						ObjectID id = object->get_instance_id();
+						if (ObjectDB::get_instance(id) != object) {
+							t->failed.set();
+						}
+						memdelete(object);
+						if (ObjectDB::get_instance(id) != nullptr || ObjectDB::get_instance(t->persistent_id) != t->persistent) {
+							t->failed.set();
+						}
+					}
+				},
+				&tester);
+	}
+	for (Thread &thread : tester.threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK_FALSE(tester.failed.is_set());
+	CHECK(ObjectDB::get_object_count() == count_before);
+	CHECK(ObjectDB::get_instance(tester.persistent_id) == &persistent);
+}
+
 TEST_CASE("[Object] Script instance property setter") {
 	Object object;
 	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
@@ -324,6 +367,29 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class _SignalReceiver : public Object {
+public:
+	int calls = 0;
+	Object *emitter = nullptr;
+	Callable other;
+
+	void receive() {
+		calls++;
+	}
+	void receive_and_connect_other() {
+		calls++;
+		if (!emitter->is_connected("my_custom_signal", other)) {
+			emitter->connect("my_custom_signal", other);
+		}
+	}
+	void receive_and_disconnect_other() {
+		calls++;
+		if (emitter->is_connected("my_custom_signal", other)) {
+			emitter->disconnect("my_custom_signal", other);
+		}
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -464,6 +530,102 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Changing connections during emission only affects later emissions") {
+		_SignalReceiver first;
+		_SignalReceiver second;
+		first.emitter = &object;
+		first.other = callable_mp(&second, &_SignalReceiver::receive);
+
+		object.connect("my_custom_signal", callable_mp(&first, &_SignalReceiver::receive_and_connect_other));
+		object.emit_signal("my_custom_signal");
+		CHECK(first.calls == 1);
+		CHECK(second.calls == 0);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(first.calls == 2);
+		CHECK(second.calls == 1);
+
+		object.disconnect("my_custom_signal", callable_mp(&first, &_SignalReceiver::receive_and_connect_other));
+		object.connect("my_custom_signal", callable_mp(&first, &_SignalReceiver::receive_and_disconnect_other));
+		// Connected after the second receiver, which is called once more before being disconnected.
+		object.emit_signal("my_custom_signal");
+		CHECK(first.calls == 3);
+		CHECK(second.calls == 2);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(first.calls == 4);
+		CHECK(second.calls == 2);
+	}
+
+	SUBCASE("One-shot connections are only called once") {
+		_SignalReceiver receiver;
+		object.connect("my_custom_signal", callable_mp(&receiver, &_SignalReceiver::receive), Object::CONNECT_ONE_SHOT);
+		object.emit_signal("my_custom_signal");
+		object.emit_signal("my_custom_signal");
+		CHECK(receiver.calls == 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&receiver, &_SignalReceiver::receive)));
+	}
+}
+
+struct _SignalEmissionThread {
+	Object emitter;
+	_SignalReceiver receiver;
+	int emissions = 0;
+
+	static void run(void *p_userdata) {
+		_SignalEmissionThread *data = (_SignalEmissionThread *)p_userdata;
+		for (int i = 0; i < data->emissions; i++) {
+			data->emitter.emit_signal("my_custom_signal");
+		}
+	}
+};
+
+TEST_CASE_PENDING("[Object] Signal emission benchmark") {
+	constexpr int EMISSIONS = 100000;
+
+	_SignalReceiver receivers[1000];
+
+	for (int listeners : { 1, 10, 1000 }) {
+		Object emitter;
+		emitter.add_user_signal(MethodInfo("my_custom_signal"));
+		for (int i = 0; i < listeners; i++) {
+			receivers[i].calls = 0;
+			emitter.connect("my_custom_signal", callable_mp(&receivers[i], &_SignalReceiver::receive));
+		}
+
+		const int emissions = EMISSIONS / listeners;
+		const uint64_t start = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < emissions; i++) {
+			emitter.emit_signal("my_custom_signal");
+		}
+		MESSAGE(emissions, " emissions to ", listeners, " listeners: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+		CHECK(receivers[listeners - 1].calls == emissions);
+	}
+
+	// Emissions on different objects from several threads shouldn't contend with each other.
+	constexpr int THREADS = 4;
+	_SignalEmissionThread emission_threads[THREADS];
+	Thread threads[THREADS];
+	for (int i = 0; i < THREADS; i++) {
+		emission_threads[i].emitter.add_user_signal(MethodInfo("my_custom_signal"));
+		emission_threads[i].emitter.connect("my_custom_signal", callable_mp(&emission_threads[i].receiver, &_SignalReceiver::receive));
+		emission_threads[i].emissions = EMISSIONS;
+	}
+
+	const uint64_t start = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < THREADS; i++) {
+		threads[i].start(&_SignalEmissionThread::run, &emission_threads[i]);
+	}
+	for (int i = 0; i < THREADS; i++) {
+		threads[i].wait_to_finish();
+	}
+	MESSAGE(THREADS, " threads x ", EMISSIONS, " emissions to 1 listener on their own object: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	for (int i = 0; i < THREADS; i++) {
+		CHECK(emission_threads[i].receiver.calls == EMISSIONS);
+	}
 }
 
 class NotificationObject1 : public Object {
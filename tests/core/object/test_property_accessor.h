@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  test_property_accessor.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PROPERTY_ACCESSOR_H
+#define TEST_PROPERTY_ACCESSOR_H
+
+#include "core/io/resource.h"
+#include "core/object/property_accessor.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPropertyAccessor {
+
+TEST_CASE("[PropertyAccessor] Get and set values") {
+	TypedArray<StringName> names;
+	names.push_back("resource_name");
+	names.push_back("resource_local_to_scene");
+	names.push_back("metadata/custom");
+	Ref<PropertyAccessor> accessor = PropertyAccessor::create("Resource", names);
+
+	REQUIRE(accessor.is_valid());
+	CHECK(accessor->get_target_class() == "Resource");
+	CHECK(accessor->get_property_count() == 3);
+
+	Ref<Resource> source;
+	source.instantiate();
+	source->set_name("Source");
+	source->set_local_to_scene(true);
+	source->set_meta("custom", 42);
+
+	Array values = accessor->get_values(source.ptr());
+	REQUIRE(values.size() == 3);
+	CHECK(values[0] == Variant("Source"));
+	CHECK(values[1] == Variant(true));
+	CHECK(values[2] == Variant(42));
+
+	Ref<Resource> target;
+	target.instantiate();
+	accessor->set_values(target.ptr(), values);
+	CHECK(target->get_name() == "Source");
+	CHECK(target->is_local_to_scene());
+	CHECK(target->get_meta("custom") == Variant(42));
+
+	// Values are written to the buffer in the same order.
+	Variant buffer[3];
+	accessor->get_values_ptr(target.ptr(), buffer);
+	CHECK(buffer[0] == values[0]);
+	CHECK(buffer[1] == values[1]);
+	CHECK(buffer[2] == values[2]);
+}
+
+TEST_CASE("[PropertyAccessor] Invalid uses") {
+	TypedArray<StringName> names;
+	names.push_back("resource_name");
+
+	ERR_PRINT_OFF;
+	CHECK(PropertyAccessor::create("NonexistentClass", names).is_null());
+
+	Ref<PropertyAccessor> accessor = PropertyAccessor::create("Resource", names);
+	Object object;
+	CHECK(accessor->get_values(&object)[0] == Variant());
+
+	Ref<Resource> resource;
+	resource.instantiate();
+	resource->set_name("Unchanged");
+	accessor->set_values(resource.ptr(), Array());
+	ERR_PRINT_ON;
+
+	CHECK(resource->get_name() == "Unchanged");
+}
+
+TEST_CASE_PENDING("[PropertyAccessor] Benchmark against Object::get") {
+	constexpr int ITERATIONS = 100000;
+
+	TypedArray<StringName> names;
+	names.push_back("resource_name");
+	names.push_back("resource_local_to_scene");
+	names.push_back("resource_path");
+	Ref<PropertyAccessor> accessor = PropertyAccessor::create("Resource", names);
+
+	Ref<Resource> resource;
+	resource.instantiate();
+
+	const StringName properties[3] = { "resource_name", "resource_local_to_scene", "resource_path" };
+	Variant values[3];
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < ITERATIONS; i++) {
+		for (int j = 0; j < 3; j++) {
+			values[j] = resource->get(properties[j]);
+		}
+	}
+	MESSAGE("Object::get: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	start = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < ITERATIONS; i++) {
+		accessor->get_values_ptr(resource.ptr(), values);
+	}
+	MESSAGE("PropertyAccessor: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	CHECK(values[1] == Variant(false));
+}
+
+} // namespace TestPropertyAccessor
+
+#endif // TEST_PROPERTY_ACCESSOR_H
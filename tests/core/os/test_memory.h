@@ -0,0 +1,189 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+// Sizes around the boundaries of the small allocation size classes.
+static const size_t test_sizes[] = { 0, 1, 15, 16, 17, 100, 480, 495, 496, 497, 512, 1000, 5000 };
+
+TEST_CASE("[Memory] Reallocation keeps contents and header") {
+	for (size_t from : test_sizes) {
+		for (size_t to : test_sizes) {
+			if (to == 0) {
+				continue;
+			}
+			uint8_t *mem = (uint8_t *)Memory::alloc_static(from, true);
+			REQUIRE(mem != nullptr);
+			for (size_t i = 0; i < from; i++) {
+				mem[i] = uint8_t(i * 7);
+			}
+			// CowData stores its element count in the header, it must survive reallocation.
+			*(uint64_t *)(mem - Memory::DATA_OFFSET + Memory::ELEMENT_OFFSET) = 1234;
+
+			mem = (uint8_t *)Memory::realloc_static(mem, to, true);
+			REQUIRE(mem != nullptr);
+			CHECK(*(uint64_t *)(mem - Memory::DATA_OFFSET + Memory::ELEMENT_OFFSET) == 1234);
+			bool same = true;
+			for (size_t i = 0; i < MIN(from, to); i++) {
+				same = same && mem[i] == uint8_t(i * 7);
+			}
+			CHECK_MESSAGE(same, vformat("Reallocating from %d to %d bytes should keep the contents.", (int64_t)from, (int64_t)to));
+			Memory::free_static(mem, true);
+		}
+	}
+}
+
+#ifdef DEBUG_ENABLED
+// The calling thread may batch its usage changes, they are flushed to read exact values.
+// Nothing else allocates while the test runs, so the changes are only the ones made here.
+static int64_t get_usage_change(uint64_t p_before) {
+	Memory::release_thread_cache();
+	return int64_t(Memory::get_mem_usage() - p_before);
+}
+
+TEST_CASE("[Memory] Usage accounting") {
+	const int64_t SMALL_SIZE = 24;
+	const int64_t GROWN_SIZE = 2 * 1024 * 1024;
+	const int64_t BIG_SIZE = 4 * 1024 * 1024;
+
+	Memory::release_thread_cache();
+	const uint64_t usage_before = Memory::get_mem_usage();
+	void *small = Memory::alloc_static(SMALL_SIZE, true);
+	CHECK(get_usage_change(usage_before) == SMALL_SIZE);
+	void *big = Memory::alloc_static(BIG_SIZE, true);
+	CHECK(get_usage_change(usage_before) == SMALL_SIZE + BIG_SIZE);
+	small = Memory::realloc_static(small, GROWN_SIZE, true);
+	CHECK(get_usage_change(usage_before) == GROWN_SIZE + BIG_SIZE);
+	Memory::free_static(small, true);
+	CHECK(get_usage_change(usage_before) == BIG_SIZE);
+	Memory::free_static(big, true);
+	CHECK(get_usage_change(usage_before) == 0);
+	CHECK(Memory::get_mem_max_usage() >= usage_before + GROWN_SIZE + BIG_SIZE);
+}
+#endif
+
+struct CrossThreadData {
+	static constexpr int COUNT = 10000;
+	void *blocks[COUNT] = {};
+};
+
+static void allocate_blocks(void *p_userdata) {
+	CrossThreadData *data = (CrossThreadData *)p_userdata;
+	for (int i = 0; i < CrossThreadData::COUNT; i++) {
+		const size_t size = 8 + i % 400;
+		data->blocks[i] = Memory::alloc_static(size, true);
+		memset(data->blocks[i], i & 0xff, size);
+	}
+}
+
+TEST_CASE("[Memory] Freeing memory allocated by another thread") {
+	CrossThreadData data;
+	Thread thread;
+	thread.start(&allocate_blocks, &data);
+	thread.wait_to_finish();
+
+	bool intact = true;
+	for (int i = 0; i < CrossThreadData::COUNT; i++) {
+		const uint8_t *block = (const uint8_t *)data.blocks[i];
+		for (size_t j = 0; j < size_t(8 + i % 400); j++) {
+			intact = intact && block[j] == (i & 0xff);
+		}
+		Memory::free_static(data.blocks[i], true);
+	}
+	CHECK(intact);
+
+	// Blocks freed here are reused by later allocations.
+	thread.start(&allocate_blocks, &data);
+	thread.wait_to_finish();
+	for (int i = 0; i < CrossThreadData::COUNT; i++) {
+		Memory::free_static(data.blocks[i], true);
+	}
+}
+
+static void allocate_and_free_small_blocks(void *p_userdata) {
+	const int count = *(int *)p_userdata;
+	void *blocks[64];
+	for (int i = 0; i < count; i += 64) {
+		for (int j = 0; j < 64; j++) {
+			blocks[j] = Memory::alloc_static(16 + (i + j) % 256, true);
+		}
+		for (int j = 0; j < 64; j++) {
+			Memory::free_static(blocks[j], true);
+		}
+	}
+	Memory::release_thread_cache();
+}
+
+static void malloc_and_free_small_blocks(void *p_userdata) {
+	const int count = *(int *)p_userdata;
+	void *blocks[64];
+	for (int i = 0; i < count; i += 64) {
+		for (int j = 0; j < 64; j++) {
+			blocks[j] = malloc(16 + (i + j) % 256);
+		}
+		for (int j = 0; j < 64; j++) {
+			free(blocks[j]);
+		}
+	}
+}
+
+static uint64_t time_threads(Thread::Callback p_callback, int p_thread_count, int p_count) {
+	Thread threads[8];
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_thread_count; i++) {
+		threads[i].start(p_callback, &p_count);
+	}
+	for (int i = 0; i < p_thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+TEST_CASE_PENDING("[Memory] Benchmark small allocations") {
+	const int count = 4000000;
+	for (int thread_count : { 1, 8 }) {
+		const uint64_t memory_usec = time_threads(&allocate_and_free_small_blocks, thread_count, count);
+		const uint64_t malloc_usec = time_threads(&malloc_and_free_small_blocks, thread_count, count);
+		MESSAGE(vformat("%d allocations on %d threads: Memory::alloc_static() %d usec, malloc() %d usec.", count, thread_count, memory_usec, malloc_usec));
+	}
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
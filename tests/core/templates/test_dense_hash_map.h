@@ -0,0 +1,223 @@
+/**************************************************************************/
+/*  test_dense_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_DENSE_HASH_MAP_H
+#define TEST_DENSE_HASH_MAP_H
+
+#include "core/templates/dense_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestDenseHashMap {
+
+TEST_CASE("[DenseHashMap] List initialization") {
+	DenseHashMap<int, String> map{ { 0, "A" }, { 1, "B" }, { 2, "C" }, { 3, "D" }, { 4, "E" } };
+
+	CHECK(map.size() == 5);
+	CHECK(map[0] == "A");
+	CHECK(map[1] == "B");
+	CHECK(map[2] == "C");
+	CHECK(map[3] == "D");
+	CHECK(map[4] == "E");
+}
+
+TEST_CASE("[DenseHashMap] Insert and overwrite element") {
+	DenseHashMap<int, int> map;
+	DenseHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+
+	map.insert(42, 1234);
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+}
+
+TEST_CASE("[DenseHashMap] Erase") {
+	DenseHashMap<int, int> map;
+	DenseHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.insert(43, 86);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+
+	CHECK(map.erase(43));
+	CHECK_FALSE(map.erase(43));
+	CHECK(map.is_empty());
+	CHECK(!map.begin());
+}
+
+TEST_CASE("[DenseHashMap] Erasing keeps insertion order") {
+	DenseHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i * 2);
+	}
+	for (int i = 0; i < 100; i += 3) {
+		map.erase(i);
+	}
+	// Re-inserted keys go to the end.
+	map.insert(0, -1);
+
+	Vector<int> expected;
+	for (int i = 0; i < 100; i++) {
+		if (i % 3 != 0) {
+			expected.push_back(i);
+		}
+	}
+	expected.push_back(0);
+
+	REQUIRE(map.size() == (uint32_t)expected.size());
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected[idx]);
+		CHECK(map.get_by_index(idx).key == expected[idx]);
+		idx++;
+	}
+
+	idx--;
+	for (DenseHashMap<int, int>::Iterator it = map.last(); it; --it) {
+		CHECK(it->key == expected[idx]);
+		idx--;
+	}
+	CHECK(idx == -1);
+}
+
+TEST_CASE("[DenseHashMap] Erased slots are reused") {
+	DenseHashMap<int, int> map;
+	map.reserve(64);
+	const uint32_t capacity = map.get_capacity();
+
+	// Keeps a constant number of elements while inserting new keys, which
+	// compacts the erased pairs away instead of growing.
+	for (int i = 0; i < 10000; i++) {
+		map.insert(i, i);
+		if (i >= 16) {
+			map.erase(i - 16);
+		}
+	}
+
+	CHECK(map.size() == 16);
+	CHECK(map.get_capacity() == capacity);
+	int expected = 10000 - 16;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected);
+		CHECK(E.value == expected);
+		expected++;
+	}
+}
+
+TEST_CASE("[DenseHashMap] Copy and clear") {
+	DenseHashMap<int, String> map;
+	for (int i = 0; i < 50; i++) {
+		map.insert(i, itos(i));
+	}
+	map.erase(10);
+	map.erase(20);
+
+	DenseHashMap<int, String> copy = map;
+	CHECK(copy.size() == 48);
+	CHECK_FALSE(copy.has(10));
+	DenseHashMap<int, String>::ConstIterator it = copy.begin();
+	for (const KeyValue<int, String> &E : map) {
+		CHECK(it->key == E.key);
+		CHECK(it->value == E.value);
+		++it;
+	}
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(copy.size() == 48);
+	map.insert(1, "1");
+	CHECK(map.begin()->key == 1);
+}
+
+TEST_CASE("[DenseHashMap] Sort") {
+	DenseHashMap<Variant, int, VariantHasher, VariantComparator> map;
+	map.insert(3, 0);
+	map.insert(1, 1);
+	map.insert(4, 2);
+	map.insert(2, 3);
+	map.erase(4);
+	map.sort();
+
+	int expected = 1;
+	for (const KeyValue<Variant, int> &E : map) {
+		CHECK(int(E.key) == expected);
+		expected++;
+	}
+	CHECK(map[2] == 3);
+}
+
+TEST_CASE("[DenseHashMap] Assign from existing key at growth boundary") {
+	DenseHashMap<int, String> map;
+	const uint32_t capacity = map.get_capacity();
+	for (uint32_t i = 0; i < capacity; i++) {
+		map[i] = String("value ") + itos(i);
+	}
+	CHECK(map.get_capacity() == capacity);
+
+	// The next insertion grows the map while the right-hand side is still referenced.
+	map[capacity] = map[0];
+	CHECK(map.get_capacity() > capacity);
+	CHECK(map[capacity] == "value 0");
+
+	const uint32_t grown_capacity = map.get_capacity();
+	for (uint32_t i = map.size(); i < grown_capacity; i++) {
+		map[i] = String("value ") + itos(i);
+	}
+	map[grown_capacity] = map[grown_capacity - 1];
+	CHECK(map[grown_capacity] == String("value ") + itos(grown_capacity - 1));
+}
+
+TEST_CASE("[DenseHashMap] Values keep their address while growing") {
+	DenseHashMap<int, String> map;
+	map[0] = "first";
+	const String *first = map.getptr(0);
+	for (int i = 1; i < 2000; i++) {
+		map[i] = itos(i);
+	}
+	CHECK(map.getptr(0) == first);
+	CHECK(*first == "first");
+
+	// Erasing other elements compacts the order, but not the values.
+	for (int i = 1; i < 2000; i += 2) {
+		map.erase(i);
+	}
+	map[2000] = "last";
+	CHECK(map.getptr(0) == first);
+	CHECK(*first == "first");
+}
+
+} // namespace TestDenseHashMap
+
+#endif // TEST_DENSE_HASH_MAP_H
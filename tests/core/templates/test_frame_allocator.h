@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*  test_frame_allocator.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FRAME_ALLOCATOR_H
+#define TEST_FRAME_ALLOCATOR_H
+
+#include "core/templates/frame_allocator.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameAllocator {
+
+TEST_CASE("[FrameAllocator] Alignment and large allocations") {
+	FrameAllocator::Scope scope;
+
+	uint8_t *a = (uint8_t *)FrameAllocator::alloc(3, 1);
+	uint64_t *b = (uint64_t *)FrameAllocator::alloc(sizeof(uint64_t), alignof(uint64_t));
+	void *c = FrameAllocator::alloc(100, 64);
+	CHECK(a != nullptr);
+	CHECK(((uintptr_t)b % alignof(uint64_t)) == 0);
+	CHECK(((uintptr_t)c % 64) == 0);
+
+	// Bigger than a page, must get its own storage.
+	uint8_t *big = (uint8_t *)FrameAllocator::alloc(FrameAllocator::DEFAULT_PAGE_SIZE * 3);
+	memset(big, 1, FrameAllocator::DEFAULT_PAGE_SIZE * 3);
+	CHECK(FrameAllocator::get_thread_usage() >= FrameAllocator::DEFAULT_PAGE_SIZE * 3);
+	CHECK(FrameAllocator::get_thread_capacity() >= FrameAllocator::DEFAULT_PAGE_SIZE * 4);
+}
+
+TEST_CASE("[FrameAllocator] Memory is recycled by the next scope") {
+	void *first = nullptr;
+	size_t capacity = 0;
+	{
+		FrameAllocator::Scope scope;
+		first = FrameAllocator::alloc(64);
+		FrameAllocator::alloc(1024);
+		CHECK(FrameAllocator::get_thread_usage() >= 1024 + 64);
+		capacity = FrameAllocator::get_thread_capacity();
+	}
+	CHECK(FrameAllocator::get_thread_usage() == 0);
+
+	{
+		FrameAllocator::Scope scope;
+		void *second = FrameAllocator::alloc(64);
+		CHECK_MESSAGE(first == second, "The arena should be rewound when the scope ends.");
+		CHECK(FrameAllocator::get_thread_capacity() == capacity);
+	}
+
+#ifdef DEBUG_ENABLED
+	// Memory released by a scope is poisoned.
+	uint8_t *bytes = nullptr;
+	{
+		FrameAllocator::Scope scope;
+		bytes = (uint8_t *)FrameAllocator::alloc(16, 16);
+		memset(bytes, 0, 16);
+	}
+	CHECK(bytes[1] == FrameAllocator::POISON_BYTE);
+	CHECK(bytes[15] == FrameAllocator::POISON_BYTE);
+#endif
+}
+
+TEST_CASE("[FrameAllocator] Nested scopes") {
+	FrameAllocator::Scope outer_scope;
+	uint32_t *values = FrameAllocator::alloc_array<uint32_t>(4);
+	for (uint32_t i = 0; i < 4; i++) {
+		values[i] = i * 10;
+	}
+	const size_t usage = FrameAllocator::get_thread_usage();
+
+	{
+		FrameAllocator::Scope scope;
+		uint32_t *more = FrameAllocator::alloc_array<uint32_t>(64);
+		CHECK(more != values);
+		CHECK(FrameAllocator::get_thread_usage() > usage);
+	}
+	CHECK_MESSAGE(FrameAllocator::get_thread_usage() == usage, "Inner scope allocations should be released.");
+	CHECK_MESSAGE(values[0] == 0, "Outer scope allocations should be kept.");
+	CHECK(values[3] == 30);
+}
+
+TEST_CASE("[FrameAllocator] Pages are merged after a big scope") {
+	{
+		FrameAllocator::Scope scope;
+		for (int i = 0; i < 4; i++) {
+			FrameAllocator::alloc(FrameAllocator::DEFAULT_PAGE_SIZE / 2 + 1);
+		}
+	}
+	const size_t capacity = FrameAllocator::get_thread_capacity();
+
+	// The next scope of the same size fits in the merged page.
+	FrameAllocator::Scope scope;
+	for (int i = 0; i < 4; i++) {
+		FrameAllocator::alloc(FrameAllocator::DEFAULT_PAGE_SIZE / 2 + 1);
+	}
+	CHECK(FrameAllocator::get_thread_capacity() == capacity);
+}
+
+TEST_CASE("[FrameAllocator] FrameVector") {
+	FrameAllocator::Scope scope;
+	FrameVector<int> vector;
+	CHECK(vector.is_empty());
+
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == 1000);
+	CHECK(vector[0] == 0);
+	CHECK(vector[999] == 999);
+
+	int sum = 0;
+	for (int v : vector) {
+		sum += v;
+	}
+	CHECK(sum == 999 * 1000 / 2);
+
+	vector.clear();
+	CHECK(vector.is_empty());
+	vector.resize(10);
+	CHECK(vector.size() == 10);
+}
+
+TEST_CASE("[FrameAllocator] FrameHashMap") {
+	FrameAllocator::Scope scope;
+	FrameHashMap<int, String> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, itos(i));
+	}
+	CHECK(map.size() == 100);
+	CHECK(map[42] == "42");
+
+	map.erase(42);
+	CHECK(!map.has(42));
+	CHECK(map.size() == 99);
+}
+
+} // namespace TestFrameAllocator
+
+#endif // TEST_FRAME_ALLOCATOR_H
@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*  test_inline_vector.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_INLINE_VECTOR_H
+#define TEST_INLINE_VECTOR_H
+
+#include "core/os/os.h"
+#include "core/templates/inline_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestInlineVector {
+
+#ifdef DEBUG_ENABLED
+// Usage changes may be batched per thread, flush them before reading the usage.
+static uint64_t get_flushed_mem_usage() {
+	Memory::release_thread_cache();
+	return Memory::get_mem_usage();
+}
+#endif
+
+TEST_CASE("[InlineVector] Inline storage") {
+#ifdef DEBUG_ENABLED
+	const uint64_t mem_usage = get_flushed_mem_usage();
+#endif
+
+	InlineVector<int, 8> vector;
+	for (int i = 0; i < 8; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.is_inline());
+	CHECK(vector.size() == 8);
+	CHECK(vector[7] == 7);
+
+	vector.remove_at(0);
+	vector.insert(0, 42);
+	CHECK(vector[0] == 42);
+	CHECK(vector.has(5));
+	CHECK(vector.find(6) == 6);
+
+#ifdef DEBUG_ENABLED
+	CHECK_MESSAGE(get_flushed_mem_usage() == mem_usage, "Nothing should be allocated while within the inline capacity.");
+
+	// The same elements spill to the heap with a smaller inline capacity.
+	InlineVector<int, 4> spilled;
+	for (int i = 0; i < 8; i++) {
+		spilled.push_back(i);
+	}
+	CHECK_FALSE(spilled.is_inline());
+	CHECK(get_flushed_mem_usage() >= mem_usage + 8 * sizeof(int));
+#endif
+}
+
+TEST_CASE("[InlineVector] Growing past the inline capacity") {
+	InlineVector<int, 4> vector;
+	for (int i = 0; i < 100; i++) {
+		vector.push_back(i);
+	}
+	CHECK_FALSE(vector.is_inline());
+	CHECK(vector.size() == 100);
+	for (int i = 0; i < 100; i++) {
+		CHECK(vector[i] == i);
+	}
+
+	vector.reset();
+	CHECK(vector.is_inline());
+	CHECK(vector.is_empty());
+	CHECK(vector.get_capacity() == 4);
+
+	vector.resize(3);
+	CHECK(vector.size() == 3);
+	CHECK(vector.is_inline());
+}
+
+TEST_CASE("[InlineVector] Copy and move") {
+	InlineVector<String, 2> small = { "a", "b" };
+	InlineVector<String, 2> big = { "a", "b", "c", "d" };
+	CHECK(small.is_inline());
+	CHECK_FALSE(big.is_inline());
+
+	InlineVector<String, 2> small_copy = small;
+	InlineVector<String, 2> big_copy = big;
+	CHECK(small_copy.size() == 2);
+	CHECK(small_copy[1] == "b");
+	CHECK(big_copy.size() == 4);
+	CHECK(big_copy[3] == "d");
+
+	InlineVector<String, 2> small_moved = std::move(small);
+	InlineVector<String, 2> big_moved = std::move(big);
+	CHECK(small.is_empty());
+	CHECK(big.is_empty());
+	CHECK(big.is_inline());
+	CHECK(small_moved.is_inline());
+	CHECK(small_moved[0] == "a");
+	CHECK_FALSE(big_moved.is_inline());
+	CHECK(big_moved[2] == "c");
+
+	small_moved = std::move(big_moved);
+	CHECK(small_moved.size() == 4);
+	CHECK(small_moved[3] == "d");
+
+	Vector<String> converted = small_moved;
+	CHECK(converted.size() == 4);
+	CHECK(converted[0] == "a");
+}
+
+TEST_CASE_PENDING("[InlineVector] Benchmark inline and spilled scratch lists") {
+	// Mimics the per-layout scratch data of containers, with a few children each time.
+	const int iterations = 1000000;
+	const int children = 16;
+	int64_t sum = 0;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		InlineVector<int, 32> scratch;
+		for (int j = 0; j < children; j++) {
+			scratch.push_back(i + j);
+		}
+		sum += scratch[children - 1];
+	}
+	const uint64_t inline_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		InlineVector<int, 4> scratch;
+		for (int j = 0; j < children; j++) {
+			scratch.push_back(i + j);
+		}
+		sum -= scratch[children - 1];
+	}
+	const uint64_t spilled_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(sum == 0);
+
+	MESSAGE(vformat("%d lists of %d elements: inline %d usec, spilled %d usec.", iterations, children, inline_usec, spilled_usec));
+}
+
+} // namespace TestInlineVector
+
+#endif // TEST_INLINE_VECTOR_H
@@ -249,6 +249,86 @@ TEST_CASE("[RID_Owner] Thread safety") {
 		tester.test();
 	}
 }
+
+TEST_CASE("[RID_Owner] Allocation under contention") {
+	// Every thread allocates and frees in a loop, then frees RIDs that another
+	// thread made, so cached free indices move between thread slots.
+	constexpr uint32_t ROUNDS = 200;
+	constexpr uint32_t RIDS_PER_ROUND = 100;
+
+	struct ContentionTester {
+		RID_Owner<uint64_t, true> rid_owner;
+		TightLocalVector<Thread> threads;
+		TightLocalVector<LocalVector<RID>> kept;
+		SafeNumeric<uint32_t> next_thread_idx;
+		std::atomic<uint32_t> errors = 0;
+	};
+
+	ContentionTester tester;
+	const uint32_t thread_count = MAX(2, OS::get_singleton()->get_processor_count());
+	tester.threads.resize(thread_count);
+	tester.kept.resize(thread_count);
+
+	const uint64_t start = OS::get_singleton()->get_ticks_usec();
+
+	for (uint32_t i = 0; i < thread_count; i++) {
+		tester.threads[i].start(
+				[](void *p_data) {
+					ContentionTester *ct = (ContentionTester *)p_data;
+					uint32_t self_th_idx = ct->next_thread_idx.postincrement();
+					RID rids[RIDS_PER_ROUND];
+
+					for (uint32_t round = 0; round < ROUNDS; round++) {
+						for (uint32_t j = 0; j < RIDS_PER_ROUND; j++) {
+							rids[j] = ct->rid_owner.make_rid(((uint64_t)self_th_idx << 32) | j);
+						}
+						for (uint32_t j = 0; j < RIDS_PER_ROUND; j++) {
+							uint64_t *value = ct->rid_owner.get_or_null(rids[j]);
+							if (!value || *value != (((uint64_t)self_th_idx << 32) | j)) {
+								ct->errors.fetch_add(1, std::memory_order_relaxed);
+							}
+							// Keep some alive for the second phase.
+							if (round % 10 == 0 && j % 10 == 0) {
+								ct->kept[self_th_idx].push_back(rids[j]);
+							} else {
+								ct->rid_owner.free(rids[j]);
+							}
+						}
+					}
+				},
+				&tester);
+	}
+	for (uint32_t i = 0; i < thread_count; i++) {
+		tester.threads[i].wait_to_finish();
+	}
+
+	CHECK_EQ(tester.errors.load(), 0u);
+	CHECK_EQ(tester.rid_owner.get_rid_count(), thread_count * (ROUNDS / 10) * (RIDS_PER_ROUND / 10));
+
+	tester.next_thread_idx.set(0);
+	for (uint32_t i = 0; i < thread_count; i++) {
+		tester.threads[i].start(
+				[](void *p_data) {
+					ContentionTester *ct = (ContentionTester *)p_data;
+					uint32_t self_th_idx = ct->next_thread_idx.postincrement();
+					const LocalVector<RID> &others = ct->kept[(self_th_idx + 1) % ct->kept.size()];
+					for (const RID &rid : others) {
+						ct->rid_owner.free(rid);
+					}
+				},
+				&tester);
+	}
+	for (uint32_t i = 0; i < thread_count; i++) {
+		tester.threads[i].wait_to_finish();
+	}
+
+	INFO("Contended allocation took ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+	CHECK_EQ(tester.rid_owner.get_rid_count(), 0u);
+
+	List<RID> owned;
+	tester.rid_owner.get_owned_list(&owned);
+	CHECK(owned.is_empty());
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
@@ -0,0 +1,238 @@
+/**************************************************************************/
+/*  test_swiss_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SWISS_HASH_MAP_H
+#define TEST_SWISS_HASH_MAP_H
+
+#include "core/os/os.h"
+#include "core/templates/a_hash_map.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/oa_hash_map.h"
+#include "core/templates/swiss_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSwissHashMap {
+
+TEST_CASE("[SwissHashMap] List initialization") {
+	SwissHashMap<int, String> map{ { 0, "A" }, { 1, "B" }, { 2, "C" }, { 3, "D" }, { 0, "E" } };
+
+	CHECK(map.size() == 4);
+	CHECK(map[0] == "E");
+	CHECK(map[1] == "B");
+	CHECK(map[2] == "C");
+	CHECK(map[3] == "D");
+}
+
+TEST_CASE("[SwissHashMap] Insert, overwrite and lookup") {
+	SwissHashMap<int, int> map;
+	CHECK_FALSE(map.has(42));
+	CHECK(map.getptr(42) == nullptr);
+
+	SwissHashMap<int, int>::Iterator e = map.insert(42, 84);
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+
+	map.insert(42, 1234);
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+	CHECK(*map.getptr(42) == 1234);
+	CHECK(map.find(42) == e);
+	CHECK_FALSE(map.find(43));
+}
+
+TEST_CASE("[SwissHashMap] Grow and keep insertion order") {
+	SwissHashMap<int, int> map;
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i * 7, i);
+	}
+	CHECK(map.size() == 1000);
+	CHECK(map.get_capacity() >= 1000);
+
+	int expected = 0;
+	bool all_found = true;
+	bool ordered = true;
+	for (const KeyValue<int, int> &E : map) {
+		ordered = ordered && E.value == expected;
+		all_found = all_found && map.has(E.key) && map[E.key] == E.value;
+		expected++;
+	}
+	CHECK(ordered);
+	CHECK(all_found);
+	CHECK_FALSE(map.has(1));
+}
+
+TEST_CASE("[SwissHashMap] Erase and reinsert") {
+	SwissHashMap<int, int> map;
+	for (int i = 0; i < 500; i++) {
+		map.insert(i, i);
+	}
+	const uint32_t capacity = map.get_capacity();
+
+	// Churn through deleted slots, the table should be reused instead of growing.
+	for (int round = 0; round < 20; round++) {
+		for (int i = 0; i < 500; i += 2) {
+			CHECK(map.erase(i));
+		}
+		CHECK_FALSE(map.erase(0));
+		CHECK(map.size() == 250);
+		for (int i = 0; i < 500; i += 2) {
+			map.insert(i, i + round);
+		}
+	}
+	CHECK(map.size() == 500);
+	CHECK(map.get_capacity() == capacity);
+
+	bool all_found = true;
+	for (int i = 0; i < 500; i++) {
+		all_found = all_found && map.has(i) && map[i] == (i % 2 ? i : i + 19);
+	}
+	CHECK(all_found);
+
+	// Erased elements are unlinked, so odd keys come first now.
+	CHECK(map.begin()->key == 1);
+	CHECK(map.last()->key == 498);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(map.begin() == map.end());
+	CHECK_FALSE(map.has(1));
+}
+
+TEST_CASE("[SwissHashMap] Replace key") {
+	SwissHashMap<int, int> map;
+	map.insert(1, 10);
+	map.insert(2, 20);
+	map.insert(3, 30);
+
+	CHECK(map.replace_key(2, 5));
+	CHECK_FALSE(map.has(2));
+	CHECK(map[5] == 20);
+
+	SwissHashMap<int, int>::Iterator it = map.begin();
+	++it;
+	CHECK(it->key == 5);
+}
+
+TEST_CASE("[SwissHashMap] Copy and StringName keys") {
+	SwissHashMap<StringName, int> map;
+	map[StringName("alpha")] = 1;
+	map[StringName("beta")] = 2;
+	map.insert(StringName("gamma"), 3, true);
+
+	SwissHashMap<StringName, int> copy = map;
+	map.erase(StringName("alpha"));
+
+	CHECK(copy.size() == 3);
+	CHECK(copy.begin()->key == StringName("gamma"));
+	CHECK(copy[StringName("alpha")] == 1);
+	CHECK(map.size() == 2);
+
+	copy.sort();
+	CHECK(copy.begin()->key == StringName("alpha"));
+	CHECK(copy.last()->key == StringName("gamma"));
+}
+
+TEST_CASE_PENDING("[SwissHashMap] Benchmark against other hash maps") {
+	constexpr int COUNT = 100000;
+	Vector<int> keys;
+	keys.resize(COUNT);
+	for (int i = 0; i < COUNT; i++) {
+		keys.write[i] = (int)hash_murmur3_one_32(i);
+	}
+
+	uint64_t found = 0;
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	{
+		HashMap<int, int> map;
+		for (int i = 0; i < COUNT; i++) {
+			map.insert(keys[i], i);
+		}
+		for (int i = 0; i < COUNT * 2; i++) {
+			found += map.has(keys[i % COUNT] + (i & 1));
+		}
+		for (int i = 0; i < COUNT; i++) {
+			map.erase(keys[i]);
+		}
+	}
+	MESSAGE("HashMap: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	start = OS::get_singleton()->get_ticks_usec();
+	{
+		AHashMap<int, int> map;
+		for (int i = 0; i < COUNT; i++) {
+			map.insert(keys[i], i);
+		}
+		for (int i = 0; i < COUNT * 2; i++) {
+			found += map.has(keys[i % COUNT] + (i & 1));
+		}
+		for (int i = 0; i < COUNT; i++) {
+			map.erase(keys[i]);
+		}
+	}
+	MESSAGE("AHashMap: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	start = OS::get_singleton()->get_ticks_usec();
+	{
+		OAHashMap<int, int> map;
+		for (int i = 0; i < COUNT; i++) {
+			map.set(keys[i], i);
+		}
+		for (int i = 0; i < COUNT * 2; i++) {
+			found += map.has(keys[i % COUNT] + (i & 1));
+		}
+		for (int i = 0; i < COUNT; i++) {
+			map.remove(keys[i]);
+		}
+	}
+	MESSAGE("OAHashMap: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	start = OS::get_singleton()->get_ticks_usec();
+	{
+		SwissHashMap<int, int> map;
+		for (int i = 0; i < COUNT; i++) {
+			map.insert(keys[i], i);
+		}
+		for (int i = 0; i < COUNT * 2; i++) {
+			found += map.has(keys[i % COUNT] + (i & 1));
+		}
+		for (int i = 0; i < COUNT; i++) {
+			map.erase(keys[i]);
+		}
+	}
+	MESSAGE("SwissHashMap: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	CHECK(found >= COUNT * 4);
+}
+
+} // namespace TestSwissHashMap
+
+#endif // TEST_SWISS_HASH_MAP_H
@@ -31,6 +31,7 @@
 #ifndef TEST_ARRAY_H
 #define TEST_ARRAY_H
 
+#include "core/os/os.h"
 #include "core/variant/array.h"
 #include "tests/test_macros.h"
 #include "tests/test_tools.h"
@@ -97,6 +98,31 @@ TEST_CASE("[Array] append_array()") {
 	CHECK(int(arr1[1]) == 2);
 }
 
+TEST_CASE("[Array] append_array() on typed arrays") {
+	Array typed_floats;
+	typed_floats.set_typed(Variant::FLOAT, StringName(), Variant());
+	typed_floats.push_back(0.5);
+
+	// Untyped source elements are converted when they can be.
+	typed_floats.append_array(build_array(1, 2.5));
+	REQUIRE(typed_floats.size() == 3);
+	CHECK(typed_floats[1].get_type() == Variant::FLOAT);
+	CHECK(double(typed_floats[1]) == 1.0);
+
+	// A single invalid element leaves the destination untouched.
+	ERR_PRINT_OFF;
+	typed_floats.append_array(build_array(3.0, "four"));
+	ERR_PRINT_ON;
+	CHECK(typed_floats.size() == 3);
+
+	Array other_floats;
+	other_floats.set_typed(Variant::FLOAT, StringName(), Variant());
+	other_floats.push_back(4.0);
+	typed_floats.append_array(other_floats);
+	CHECK(typed_floats.size() == 4);
+	CHECK(double(typed_floats[3]) == 4.0);
+}
+
 TEST_CASE("[Array] resize(), insert(), and erase()") {
 	Array arr;
 	arr.resize(2);
@@ -169,6 +195,27 @@ TEST_CASE("[Array] sort()") {
 	}
 }
 
+TEST_CASE("[Array] sort() on large arrays") {
+	// Large enough to be sorted in parallel when worker threads are available.
+	constexpr int SIZE = 100000;
+	Array arr;
+	arr.resize(SIZE);
+	for (int i = 0; i < SIZE; i++) {
+		arr[i] = int(int64_t(i) * 7919 % SIZE);
+	}
+	arr.sort();
+
+	bool sorted = true;
+	for (int i = 0; i < SIZE; i++) {
+		if (int(arr[i]) != i) {
+			sorted = false;
+			break;
+		}
+	}
+	CHECK(sorted);
+	CHECK(arr.size() == SIZE);
+}
+
 TEST_CASE("[Array] push_front(), pop_front(), pop_back()") {
 	Array arr;
 	arr.push_front(1);
@@ -652,6 +699,51 @@ TEST_CASE("[Array] Test rfind_custom") {
 	CHECK_EQ(index, 4);
 }
 
+TEST_CASE("[Array] filter(), map(), any() and all() with method callables") {
+	Object object;
+	const Callable has_method = Callable(&object, "has_method");
+	const Array names = build_array("get", "missing_method", "set", "call");
+
+	const Array filtered = names.filter(has_method);
+	CHECK(filtered == build_array("get", "set", "call"));
+	CHECK(names.map(has_method) == build_array(true, false, true, true));
+	CHECK(names.any(has_method));
+	CHECK_FALSE(names.all(has_method));
+	CHECK(filtered.all(has_method));
+}
+
+TEST_CASE_PENDING("[Array] Bulk operations benchmark") {
+	constexpr int SIZE = 1000000;
+	Array arr;
+	arr.resize(SIZE);
+	for (int i = 0; i < SIZE; i++) {
+		arr[i] = int(int64_t(i) * 7919 % SIZE);
+	}
+
+	Array appended;
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		appended.append_array(arr);
+	}
+	MESSAGE("append_array() of ", SIZE, " elements 10 times: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	Array names;
+	names.resize(SIZE);
+	for (int i = 0; i < SIZE; i++) {
+		names[i] = i % 2 ? "get" : "missing_method";
+	}
+	Object object;
+	start = OS::get_singleton()->get_ticks_usec();
+	const Array mapped = names.map(Callable(&object, "has_method"));
+	MESSAGE("map() over ", SIZE, " elements: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+	CHECK(mapped.size() == SIZE);
+
+	start = OS::get_singleton()->get_ticks_usec();
+	arr.sort();
+	MESSAGE("sort() of ", SIZE, " elements: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+	CHECK(int(arr[SIZE - 1]) == SIZE - 1);
+}
+
 } // namespace TestArray
 
 #endif // TEST_ARRAY_H
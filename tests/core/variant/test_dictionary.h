@@ -31,6 +31,7 @@
 #ifndef TEST_DICTIONARY_H
 #define TEST_DICTIONARY_H
 
+#include "core/os/os.h"
 #include "core/variant/typed_dictionary.h"
 #include "tests/test_macros.h"
 
@@ -557,6 +558,80 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Order after erasing") {
+	Dictionary d;
+	for (int i = 0; i < 64; i++) {
+		d[i] = i;
+	}
+	for (int i = 0; i < 64; i += 2) {
+		d.erase(i);
+	}
+	d[0] = "zero";
+
+	CHECK(d.size() == 33);
+	CHECK(d.get_key_at_index(0) == Variant(1));
+	CHECK(d.get_key_at_index(31) == Variant(63));
+	CHECK(d.get_key_at_index(32) == Variant(0));
+	CHECK(d.get_value_at_index(32) == Variant("zero"));
+	CHECK(d.get_key_at_index(33) == Variant());
+
+	int expected = 1;
+	for (const Variant *key = d.next(); key; key = d.next(key)) {
+		CHECK(*key == (expected < 64 ? Variant(expected) : Variant(0)));
+		expected += 2;
+	}
+	CHECK(expected == 67);
+}
+
+TEST_CASE("[Dictionary] Assign from existing key while growing") {
+	// Every insertion count up to a few growth steps, so that one of them
+	// lands exactly on the boundary where the backing storage is enlarged.
+	for (int count = 1; count < 100; count++) {
+		Dictionary d;
+		for (int i = 0; i < count; i++) {
+			d[i] = String("value ") + itos(i);
+		}
+		d[count] = d[0];
+		d[count + 1] = d[count - 1];
+
+		CHECK(d.size() == count + 2);
+		CHECK(d[count] == Variant("value 0"));
+		CHECK(d[count + 1] == Variant(String("value ") + itos(count - 1)));
+	}
+}
+
+TEST_CASE_PENDING("[Dictionary] Memory and throughput benchmark") {
+	for (int size : { 100, 10000, 1000000 }) {
+		const uint64_t memory = Memory::get_mem_usage();
+		uint64_t start = OS::get_singleton()->get_ticks_usec();
+		Dictionary d;
+		for (int i = 0; i < size; i++) {
+			d[i] = i;
+		}
+		MESSAGE(size, " insertions: ", OS::get_singleton()->get_ticks_usec() - start, " usec, ", Memory::get_mem_usage() - memory, " bytes.");
+
+		start = OS::get_singleton()->get_ticks_usec();
+		int64_t sum = 0;
+		for (int i = 0; i < size; i++) {
+			sum += int64_t(d[i]);
+		}
+		MESSAGE(size, " lookups: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+		start = OS::get_singleton()->get_ticks_usec();
+		for (const Variant *key = d.next(); key; key = d.next(key)) {
+			sum -= int64_t(*key);
+		}
+		MESSAGE(size, " iterations: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+		CHECK(sum == 0);
+
+		start = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < size; i += 2) {
+			d.erase(i);
+		}
+		MESSAGE((size / 2), " erasures: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+	}
+}
+
 TEST_CASE("[Dictionary] Typed copying") {
 	TypedDictionary<int, int> d1;
 	d1[0] = 1;
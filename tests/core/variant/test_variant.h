@@ -1755,6 +1755,43 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Writer and parser strings") {
+	String long_string;
+	for (int i = 0; i < 50; i++) {
+		long_string += "ab\"c\\";
+	}
+	const String strings[] = { "", "x", "node_name", "tab\tand \"quotes\"", U"Unicode ¡ǅЖ 😀", long_string };
+
+	for (const String &str : strings) {
+		String written;
+		VariantWriter::write_to_string(str, written);
+
+		VariantParser::StreamString ss;
+		String errs;
+		int line;
+		Variant parsed;
+
+		ss.s = written;
+		CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+		CHECK_MESSAGE(parsed == Variant(str), "Should parse back.");
+	}
+
+	String errs;
+	int line;
+	Variant parsed;
+
+	VariantParser::StreamString string_name_ss;
+	string_name_ss.s = "&\"some_name\"";
+	CHECK(VariantParser::parse(&string_name_ss, parsed, errs, line) == OK);
+	CHECK(parsed.get_type() == Variant::STRING_NAME);
+	CHECK(parsed == Variant(StringName("some_name")));
+
+	VariantParser::StreamString escapes_ss;
+	escapes_ss.s = "\"\\u0041\\U01F600\"";
+	CHECK(VariantParser::parse(&escapes_ss, parsed, errs, line) == OK);
+	CHECK(parsed == Variant(U"A😀"));
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
@@ -0,0 +1,507 @@
+/**************************************************************************/
+/*  test_tile_map_layer.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TILE_MAP_LAYER_H
+#define TEST_TILE_MAP_LAYER_H
+
+#include "core/io/image.h"
+#include "scene/2d/tile_map_layer.h"
+#include "scene/main/window.h"
+#include "scene/resources/atlas_texture.h"
+#include "scene/resources/image_texture.h"
+#include "scene/resources/2d/world_2d.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#ifndef _PHYSICS_DISABLED
+#include "servers/physics_server_2d.h"
+#endif // !_PHYSICS_DISABLED
+
+#include "tests/test_macros.h"
+
+namespace TestTileMapLayer {
+
+// A tile set with a single 8x8 tile at (0, 0), without texture padding so that the texture is used as-is.
+static Ref<TileSet> create_tile_set(const Ref<Texture2D> &p_texture, Ref<TileSetAtlasSource> *r_source = nullptr) {
+	Ref<TileSet> tile_set;
+	tile_set.instantiate();
+	tile_set->set_tile_size(Vector2i(8, 8));
+
+	Ref<TileSetAtlasSource> source;
+	source.instantiate();
+	source->set_use_texture_padding(false);
+	source->set_texture(p_texture);
+	source->set_texture_region_size(Vector2i(8, 8));
+	source->create_tile(Vector2i(0, 0));
+	tile_set->add_source(source, 0);
+
+	if (r_source) {
+		*r_source = source;
+	}
+	return tile_set;
+}
+
+// Red, green, blue and white quarters, so that every flip and transpose gives a different tile.
+static Ref<ImageTexture> create_quarters_texture(const Size2i &p_size = Size2i(8, 8)) {
+	Ref<Image> image = Image::create_empty(p_size.width, p_size.height, false, Image::FORMAT_RGBA8);
+	image->fill_rect(Rect2i(0, 0, 4, 4), Color(1, 0, 0));
+	image->fill_rect(Rect2i(4, 0, 4, 4), Color(0, 1, 0));
+	image->fill_rect(Rect2i(0, 4, 4, 4), Color(0, 0, 1));
+	image->fill_rect(Rect2i(4, 4, 4, 4), Color(1, 1, 1));
+	return ImageTexture::create_from_image(image);
+}
+
+static TileMapLayer *create_layer(const Ref<TileSet> &p_tile_set) {
+	TileMapLayer *layer = memnew(TileMapLayer);
+	layer->set_tile_set(p_tile_set);
+	layer->set_texture_filter(CanvasItem::TEXTURE_FILTER_NEAREST);
+	SceneTree::get_singleton()->get_root()->add_child(layer);
+	return layer;
+}
+
+// Counts the commands of a type in the canvas items of the layer's quadrants.
+static int count_quadrant_commands(TileMapLayer *p_layer, RendererCanvasRender::Item::Command::Type p_type) {
+	int count = 0;
+	const RendererCanvasCull::Item *layer_item = RSG::canvas->canvas_item_owner.get_or_null(p_layer->get_canvas_item());
+	for (const RendererCanvasCull::Item *quadrant_item : layer_item->child_items) {
+		for (const RendererCanvasRender::Item::Command *c = quadrant_item->commands; c; c = c->next) {
+			count += c->type == p_type ? 1 : 0;
+		}
+	}
+	return count;
+}
+
+static int count_quadrant_canvas_items(TileMapLayer *p_layer) {
+	return RSG::canvas->canvas_item_owner.get_or_null(p_layer->get_canvas_item())->child_items.size();
+}
+
+// Draws the layer's canvas in a transparent viewport and reads back the result.
+static Ref<Image> render_layer(TileMapLayer *p_layer, const Size2i &p_size) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID viewport = rs->viewport_create();
+	rs->viewport_set_size(viewport, p_size.width, p_size.height);
+	rs->viewport_set_transparent_background(viewport, true);
+	rs->viewport_set_update_mode(viewport, RS::VIEWPORT_UPDATE_ALWAYS);
+	rs->viewport_attach_canvas(viewport, p_layer->get_canvas());
+	rs->viewport_set_active(viewport, true);
+
+	rs->draw(false);
+	Ref<Image> image = rs->texture_2d_get(rs->viewport_get_texture(viewport));
+
+	rs->free(viewport);
+	return image;
+}
+
+TEST_CASE("[SceneTree][SoftwareCanvas][TileMapLayer] Baked quadrants") {
+	Ref<TileSetAtlasSource> source;
+	Ref<TileSet> tile_set = create_tile_set(create_quarters_texture(), &source);
+	TileMapLayer *layer = create_layer(tile_set);
+
+	SUBCASE("Flipped and transposed tiles are drawn the same") {
+		// Every combination of the transform flags, one tile each.
+		for (int i = 0; i < 8; i++) {
+			int alternative_tile = 0;
+			alternative_tile |= (i & 1) ? TileSetAtlasSource::TRANSFORM_FLIP_H : 0;
+			alternative_tile |= (i & 2) ? TileSetAtlasSource::TRANSFORM_FLIP_V : 0;
+			alternative_tile |= (i & 4) ? TileSetAtlasSource::TRANSFORM_TRANSPOSE : 0;
+			layer->set_cell(Vector2i(i, 0), 0, Vector2i(0, 0), alternative_tile);
+		}
+		layer->update_internals();
+		CHECK(count_quadrant_commands(layer, RendererCanvasRender::Item::Command::TYPE_POLYGON) == 0);
+		const Ref<Image> tiles = render_layer(layer, Size2i(64, 8));
+		REQUIRE(tiles.is_valid());
+		CHECK(tiles->get_pixel(1, 1).is_equal_approx(Color(1, 0, 0)));
+		CHECK(tiles->get_pixel(9, 1).is_equal_approx(Color(0, 1, 0)));
+		CHECK(tiles->get_pixel(17, 1).is_equal_approx(Color(0, 0, 1)));
+
+		layer->set_rendering_quadrant_baked(true);
+		layer->update_internals();
+		CHECK(count_quadrant_commands(layer, RendererCanvasRender::Item::Command::TYPE_RECT) == 0);
+		CHECK(count_quadrant_commands(layer, RendererCanvasRender::Item::Command::TYPE_POLYGON) == 1);
+		const Ref<Image> baked = render_layer(layer, Size2i(64, 8));
+		REQUIRE(baked.is_valid());
+
+		// Tile edges are left out, they depend on how the rasterizer treats shared edges.
+		int mismatches = 0;
+		for (int y = 1; y < 7; y++) {
+			for (int x = 0; x < 64; x++) {
+				if (x % 8 == 0 || x % 8 == 7) {
+					continue;
+				}
+				mismatches += tiles->get_pixel(x, y).is_equal_approx(baked->get_pixel(x, y)) ? 0 : 1;
+			}
+		}
+		CHECK(mismatches == 0);
+	}
+
+	SUBCASE("Animated tiles are drawn per tile") {
+		source->set_texture(create_quarters_texture(Size2i(16, 8)));
+		source->set_tile_animation_frames_count(Vector2i(0, 0), 2);
+		layer->set_rendering_quadrant_baked(true);
+		layer->set_cell(Vector2i(0, 0), 0, Vector2i(0, 0));
+		layer->set_cell(Vector2i(1, 0), 0, Vector2i(0, 0));
+		layer->update_internals();
+		CHECK(count_quadrant_commands(layer, RendererCanvasRender::Item::Command::TYPE_POLYGON) == 0);
+		CHECK(count_quadrant_commands(layer, RendererCanvasRender::Item::Command::TYPE_RECT) == 4);
+	}
+
+	SUBCASE("AtlasTexture tiles are drawn per tile") {
+		Ref<AtlasTexture> atlas_texture;
+		atlas_texture.instantiate();
+		atlas_texture->set_atlas(create_quarters_texture());
+		atlas_texture->set_region(Rect2(0, 0, 8, 8));
+		source->set_texture(atlas_texture);
+		layer->set_rendering_quadrant_baked(true);
+		layer->set_cell(Vector2i(0, 0), 0, Vector2i(0, 0));
+		layer->set_cell(Vector2i(1, 0), 0, Vector2i(0, 0));
+		layer->update_internals();
+		CHECK(count_quadrant_commands(layer, RendererCanvasRender::Item::Command::TYPE_POLYGON) == 0);
+		CHECK(count_quadrant_commands(layer, RendererCanvasRender::Item::Command::TYPE_RECT) == 2);
+	}
+
+	memdelete(layer);
+}
+
+TEST_CASE("[SceneTree][SoftwareCanvas][TileMapLayer] Baked quadrants built on worker threads") {
+	// Tiles are twice as wide as the cells, so that neighbors overlap on half of their width.
+	Ref<TileSet> tile_set = create_tile_set(create_quarters_texture());
+	tile_set->set_tile_size(Vector2i(4, 8));
+	TileMapLayer *layer = create_layer(tile_set);
+	layer->set_rendering_quadrant_baked(true);
+	layer->set_self_modulate(Color(0, 1, 1));
+	layer->set_y_sort_enabled(true);
+	layer->set_x_draw_order_reversed(true);
+	layer->update_internals();
+
+	// Each row is its own y-sorted quadrant, so that the rows are built in parallel.
+	for (int y = 0; y < 4; y++) {
+		layer->set_cell(Vector2i(1, y), 0, Vector2i(0, 0));
+		layer->set_cell(Vector2i(2, y), 0, Vector2i(0, 0), TileSetAtlasSource::TRANSFORM_FLIP_V);
+	}
+	layer->update_internals();
+	CHECK(count_quadrant_canvas_items(layer) == 4);
+	CHECK(count_quadrant_commands(layer, RendererCanvasRender::Item::Command::TYPE_POLYGON) == 4);
+
+	// Where the tiles overlap, the left tile is drawn last and shows its green quarter.
+	// The blue quarter of the right tile is drawn below it.
+	const Ref<Image> reversed = render_layer(layer, Size2i(16, 32));
+	REQUIRE(reversed.is_valid());
+	for (int y = 0; y < 4; y++) {
+		CHECK(reversed->get_pixel(3, y * 8 + 1).is_equal_approx(Color(0, 0, 0))); // Modulated red.
+		CHECK(reversed->get_pixel(7, y * 8 + 1).is_equal_approx(Color(0, 1, 0)));
+		CHECK(reversed->get_pixel(12, y * 8 + 1).is_equal_approx(Color(0, 1, 1))); // Modulated white.
+	}
+
+	layer->set_x_draw_order_reversed(false);
+	layer->update_internals();
+	const Ref<Image> ordered = render_layer(layer, Size2i(16, 32));
+	REQUIRE(ordered.is_valid());
+	for (int y = 0; y < 4; y++) {
+		CHECK(ordered->get_pixel(7, y * 8 + 1).is_equal_approx(Color(0, 0, 1)));
+	}
+
+	memdelete(layer);
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Cells in rect") {
+	TileMapLayer *layer = memnew(TileMapLayer);
+
+	// Source ID, atlas X, atlas Y and alternative tile, row by row.
+	const PackedInt32Array cells = {
+		0, 1, 2, 0, -1, -1, -1, -1, 3, 4, 5, 1, //
+		2, 0, 0, 0, 2, 1, 0, 0, -1, -1, -1, -1, //
+	};
+	layer->set_cells_in_rect(Rect2i(-1, 2, 3, 2), cells);
+
+	CHECK(layer->get_used_cells().size() == 4);
+	CHECK(layer->get_cell_source_id(Vector2i(-1, 2)) == 0);
+	CHECK(layer->get_cell_atlas_coords(Vector2i(-1, 2)) == Vector2i(1, 2));
+	CHECK(layer->get_cell_source_id(Vector2i(0, 2)) == TileSet::INVALID_SOURCE);
+	CHECK(layer->get_cell_alternative_tile(Vector2i(1, 2)) == 1);
+	CHECK(layer->get_cell_atlas_coords(Vector2i(0, 3)) == Vector2i(1, 0));
+
+	SUBCASE("Reading back") {
+		CHECK(layer->get_cells_in_rect(Rect2i(-1, 2, 3, 2)) == cells);
+
+		const PackedInt32Array row = layer->get_cells_in_rect(Rect2i(-2, 3, 2, 1));
+		CHECK(row == PackedInt32Array({ -1, -1, -1, -1, 2, 0, 0, 0 }));
+		CHECK(layer->get_cells_in_rect(Rect2i(0, 0, 0, 4)).is_empty());
+	}
+
+	SUBCASE("Erasing") {
+		PackedInt32Array empty;
+		empty.resize(6 * 4);
+		empty.fill(-1);
+		layer->set_cells_in_rect(Rect2i(-1, 2, 3, 2), empty);
+		CHECK(layer->get_used_cells().is_empty());
+	}
+
+	SUBCASE("Wrong data size") {
+		ERR_PRINT_OFF;
+		layer->set_cells_in_rect(Rect2i(5, 5, 2, 2), PackedInt32Array({ 0, 0, 0, 0 }));
+		ERR_PRINT_ON;
+		CHECK(layer->get_used_cells().size() == 4);
+	}
+
+	memdelete(layer);
+}
+
+TEST_CASE("[TileMapLayer] Chunked cell storage") {
+	CellDataMap cells;
+	CellData cell_data;
+
+	// Fill two chunks on each side of the origin.
+	const int size = CellDataMap::CHUNK_SIZE;
+	for (int y = -size; y < size; y++) {
+		for (int x = -size; x < size; x++) {
+			cell_data.coords = Vector2i(x, y);
+			cell_data.cell.source_id = x + y * 100;
+			cells.insert(Vector2i(x, y), cell_data);
+		}
+	}
+	CHECK(cells.size() == uint32_t(4 * size * size));
+	CHECK(cells.get_chunk_count() == 4);
+
+	// Cells keep their address when more chunks are created.
+	CellData *first = cells.getptr(Vector2i(-size, -size));
+	REQUIRE(first);
+	CHECK(first->dirty_list_element.self() == first);
+	for (int i = 1; i < 100; i++) {
+		cell_data.coords = Vector2i(i * size, 0);
+		cells.insert(cell_data.coords, cell_data);
+	}
+	CHECK(cells.getptr(Vector2i(-size, -size)) == first);
+	CHECK(first->cell.source_id == -size - size * 100);
+
+	// Overwriting keeps the cell in place.
+	cell_data.coords = Vector2i(-size, -size);
+	cell_data.cell.source_id = 7;
+	CHECK(cells.insert(cell_data.coords, cell_data)->value.cell.source_id == 7);
+	CHECK(cells.getptr(cell_data.coords) == first);
+	CHECK(cells.size() == uint32_t(4 * size * size + 99));
+
+	// Iterating visits every cell once.
+	uint32_t count = 0;
+	for (const KeyValue<Vector2i, CellData> &E : cells) {
+		CHECK(E.key == E.value.coords);
+		count++;
+	}
+	CHECK(count == cells.size());
+
+	// Empty chunks are freed.
+	for (int i = 1; i < 100; i++) {
+		CHECK(cells.erase(Vector2i(i * size, 0)));
+	}
+	CHECK_FALSE(cells.erase(Vector2i(size, 0)));
+	CHECK(cells.get_chunk_count() == 4);
+	CHECK_FALSE(cells.has(Vector2i(size, 0)));
+	CHECK(cells.has(Vector2i(size - 1, -1)));
+	CHECK(cells.getptr(Vector2i(-1, size - 1))->cell.source_id == -1 + (size - 1) * 100);
+
+	cells.clear();
+	CHECK(cells.is_empty());
+	CHECK(cells.begin() == cells.end());
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Rendering quadrant updates per frame") {
+	TileMapLayer *layer = create_layer(create_tile_set(create_quarters_texture()));
+	layer->set_rendering_quadrant_size(1);
+	layer->set_rendering_quadrant_updates_per_frame(2);
+	layer->update_internals();
+
+	// One quadrant per cell.
+	for (int i = 0; i < 5; i++) {
+		layer->set_cell(Vector2i(i, 0), 0, Vector2i(0, 0));
+	}
+
+	SUBCASE("Quadrants over the budget are built on later frames") {
+		layer->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		CHECK(count_quadrant_canvas_items(layer) == 2);
+		CHECK(layer->is_processing_internal());
+
+		layer->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		CHECK(count_quadrant_canvas_items(layer) == 4);
+		CHECK(layer->is_processing_internal());
+
+		layer->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		CHECK(count_quadrant_canvas_items(layer) == 5);
+		CHECK_FALSE(layer->is_processing_internal());
+	}
+
+	SUBCASE("update_internals() ignores the budget") {
+		layer->update_internals();
+		CHECK(count_quadrant_canvas_items(layer) == 5);
+		CHECK_FALSE(layer->is_processing_internal());
+	}
+
+	SUBCASE("No budget") {
+		layer->set_rendering_quadrant_updates_per_frame(0);
+		layer->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		CHECK(count_quadrant_canvas_items(layer) == 5);
+	}
+
+	memdelete(layer);
+}
+
+#ifndef _PHYSICS_DISABLED
+// The distinct bodies found at the center of the cells.
+static LocalVector<RID> get_bodies_at_cells(TileMapLayer *p_layer, const Vector<Vector2i> &p_cells) {
+	PhysicsDirectSpaceState2D *space_state = p_layer->get_world_2d()->get_direct_space_state();
+	LocalVector<RID> bodies;
+	for (const Vector2i &cell : p_cells) {
+		PhysicsDirectSpaceState2D::PointParameters parameters;
+		parameters.position = p_layer->to_global(p_layer->map_to_local(cell));
+		PhysicsDirectSpaceState2D::ShapeResult results[4];
+		const int count = space_state->intersect_point(parameters, results, 4);
+		for (int i = 0; i < count; i++) {
+			if (!bodies.has(results[i].rid)) {
+				bodies.push_back(results[i].rid);
+			}
+		}
+	}
+	return bodies;
+}
+
+TEST_CASE("[SceneTree][TileMapLayer] Merged collisions") {
+	// Full squares on two physics layers. The second tile is one-way, the third has a constant velocity.
+	Ref<TileSetAtlasSource> source;
+	Ref<TileSet> tile_set = create_tile_set(create_quarters_texture(Size2i(24, 8)), &source);
+	tile_set->add_physics_layer();
+	tile_set->add_physics_layer();
+	source->create_tile(Vector2i(1, 0));
+	source->create_tile(Vector2i(2, 0));
+	const Vector<Vector2> square = { Vector2(-4, -4), Vector2(4, -4), Vector2(4, 4), Vector2(-4, 4) };
+	for (int x = 0; x < 3; x++) {
+		TileData *tile_data = source->get_tile_data(Vector2i(x, 0), 0);
+		for (int physics_layer = 0; physics_layer < 2; physics_layer++) {
+			tile_data->add_collision_polygon(physics_layer);
+			tile_data->set_collision_polygon_points(physics_layer, 0, square);
+		}
+	}
+	for (int physics_layer = 0; physics_layer < 2; physics_layer++) {
+		source->get_tile_data(Vector2i(1, 0), 0)->set_collision_polygon_one_way(physics_layer, 0, true);
+		source->get_tile_data(Vector2i(2, 0), 0)->set_constant_linear_velocity(physics_layer, Vector2(10, 0));
+	}
+
+	TileMapLayer *layer = create_layer(tile_set);
+	layer->set_collision_merged(true);
+
+	// Two 4x2 blocks of full squares, one row apart.
+	Vector<Vector2i> block_cells;
+	for (int y : { 0, 1, 3, 4 }) {
+		for (int x = 0; x < 4; x++) {
+			layer->set_cell(Vector2i(x, y), 0, Vector2i(0, 0));
+			block_cells.push_back(Vector2i(x, y));
+		}
+	}
+	const Vector2i one_way_cell(6, 0);
+	const Vector2i moving_cell(8, 0);
+	layer->set_cell(one_way_cell, 0, Vector2i(1, 0));
+	layer->set_cell(moving_cell, 0, Vector2i(2, 0));
+	layer->update_internals();
+
+	SUBCASE("Full squares are merged into one body per physics layer") {
+		const LocalVector<RID> bodies = get_bodies_at_cells(layer, block_cells);
+		REQUIRE(bodies.size() == 2);
+		for (const RID &body : bodies) {
+			CHECK_MESSAGE(PhysicsServer2D::get_singleton()->body_get_shape_count(body) == 2, "Each block should be a single rectangle.");
+			CHECK(layer->get_coords_for_body_rid(body) == Vector2i(0, 0));
+		}
+	}
+
+	SUBCASE("One-way and constant velocity tiles keep their own bodies") {
+		for (const Vector2i &cell : { one_way_cell, moving_cell }) {
+			const LocalVector<RID> bodies = get_bodies_at_cells(layer, { cell });
+			REQUIRE(bodies.size() == 2);
+			for (const RID &body : bodies) {
+				CHECK(layer->get_coords_for_body_rid(body) == cell);
+			}
+		}
+	}
+
+	SUBCASE("Disabling merging restores per-cell bodies") {
+		layer->set_collision_merged(false);
+		layer->update_internals();
+		const LocalVector<RID> bodies = get_bodies_at_cells(layer, block_cells);
+		CHECK(bodies.size() == (uint32_t)block_cells.size() * 2);
+		for (const RID &body : bodies) {
+			CHECK(PhysicsServer2D::get_singleton()->body_get_shape_count(body) == 1);
+		}
+	}
+
+	memdelete(layer);
+}
+#endif // !_PHYSICS_DISABLED
+
+TEST_CASE_PENDING("[SceneTree][TileMapLayer] Cell storage benchmark") {
+	constexpr int SIZE = 512;
+	PackedInt32Array cells;
+	cells.resize(SIZE * SIZE * 4);
+	for (int i = 0; i < SIZE * SIZE; i++) {
+		cells.set(i * 4 + 0, 0);
+		cells.set(i * 4 + 1, i % 8);
+		cells.set(i * 4 + 2, i % 4);
+		cells.set(i * 4 + 3, 0);
+	}
+
+	TileMapLayer *layer = memnew(TileMapLayer);
+	const uint64_t memory = Memory::get_mem_usage();
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	layer->set_cells_in_rect(Rect2i(0, 0, SIZE, SIZE), cells);
+	MESSAGE((SIZE * SIZE), " cells set in a rect: ", OS::get_singleton()->get_ticks_usec() - start, " usec, ", ((Memory::get_mem_usage() - memory) / (SIZE * SIZE)), " bytes per cell.");
+
+	start = OS::get_singleton()->get_ticks_usec();
+	int64_t sum = 0;
+	for (int y = 0; y < SIZE; y++) {
+		for (int x = 0; x < SIZE; x++) {
+			sum += layer->get_cell_atlas_coords(Vector2i(x, y)).x;
+		}
+	}
+	MESSAGE((SIZE * SIZE), " cells read one by one: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+
+	start = OS::get_singleton()->get_ticks_usec();
+	const PackedInt32Array read = layer->get_cells_in_rect(Rect2i(0, 0, SIZE, SIZE));
+	for (int i = 0; i < SIZE * SIZE; i++) {
+		sum -= read[i * 4 + 1];
+	}
+	MESSAGE((SIZE * SIZE), " cells read in a rect: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+	CHECK(sum == 0);
+
+	start = OS::get_singleton()->get_ticks_usec();
+	const TypedArray<Vector2i> used_cells = layer->get_used_cells();
+	MESSAGE((SIZE * SIZE), " cells iterated: ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+	CHECK(used_cells.size() == SIZE * SIZE);
+
+	memdelete(layer);
+}
+
+} // namespace TestTileMapLayer
+
+#endif // TEST_TILE_MAP_LAYER_H
@@ -0,0 +1,213 @@
+/**************************************************************************/
+/*  test_rasterizer_canvas_software.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RASTERIZER_CANVAS_SOFTWARE_H
+#define TEST_RASTERIZER_CANVAS_SOFTWARE_H
+
+#include "core/io/image.h"
+#include "servers/rendering_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRasterizerCanvasSoftware {
+
+// Draws the canvas in a transparent viewport and reads back the result.
+static Ref<Image> render_canvas(RID p_canvas, const Size2i &p_size) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID viewport = rs->viewport_create();
+	rs->viewport_set_size(viewport, p_size.width, p_size.height);
+	rs->viewport_set_transparent_background(viewport, true);
+	rs->viewport_set_update_mode(viewport, RS::VIEWPORT_UPDATE_ALWAYS);
+	rs->viewport_attach_canvas(viewport, p_canvas);
+	rs->viewport_set_active(viewport, true);
+
+	rs->draw(false);
+	Ref<Image> image = rs->texture_2d_get(rs->viewport_get_texture(viewport));
+
+	rs->free(viewport);
+	return image;
+}
+
+static bool pixel_is(const Ref<Image> &p_image, int p_x, int p_y, const Color &p_color) {
+	const Color pixel = p_image->get_pixel(p_x, p_y);
+	const float tolerance = 1.5 / 255.0;
+	return Math::abs(pixel.r - p_color.r) < tolerance && Math::abs(pixel.g - p_color.g) < tolerance && Math::abs(pixel.b - p_color.b) < tolerance && Math::abs(pixel.a - p_color.a) < tolerance;
+}
+
+TEST_CASE("[SceneTree][SoftwareCanvas] Draw canvas items on the CPU") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID canvas = rs->canvas_create();
+	RID item = rs->canvas_item_create();
+	rs->canvas_item_set_parent(item, canvas);
+	rs->canvas_item_set_default_texture_filter(item, RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST);
+
+	const Color red(1, 0, 0);
+	const Color green(0, 1, 0);
+	const Color blue(0, 0, 1);
+	const Color white(1, 1, 1);
+	const Color transparent(0, 0, 0, 0);
+
+	SUBCASE("Rects") {
+		rs->canvas_item_add_rect(item, Rect2(2, 2, 4, 4), red);
+		Ref<Image> image = render_canvas(canvas, Size2i(8, 8));
+		REQUIRE(image.is_valid());
+		CHECK(image->get_size() == Size2i(8, 8));
+		CHECK(pixel_is(image, 2, 2, red));
+		CHECK(pixel_is(image, 5, 5, red));
+		CHECK(pixel_is(image, 1, 1, transparent));
+		CHECK(pixel_is(image, 6, 6, transparent));
+	}
+
+	SUBCASE("Modulate and blending") {
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 8, 8), white);
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 4, 8), Color(0, 0, 1, 0.5));
+		rs->canvas_item_set_modulate(item, Color(1, 1, 0));
+		Ref<Image> image = render_canvas(canvas, Size2i(8, 8));
+		REQUIRE(image.is_valid());
+		CHECK(pixel_is(image, 1, 1, Color(0.5, 0.5, 0, 1)));
+		CHECK(pixel_is(image, 6, 6, Color(1, 1, 0)));
+	}
+
+	SUBCASE("Textures") {
+		Ref<Image> texture_image = Image::create_empty(2, 2, false, Image::FORMAT_RGBA8);
+		texture_image->set_pixel(0, 0, red);
+		texture_image->set_pixel(1, 0, green);
+		texture_image->set_pixel(0, 1, blue);
+		texture_image->set_pixel(1, 1, white);
+		RID texture = rs->texture_2d_create(texture_image);
+
+		rs->canvas_item_add_texture_rect(item, Rect2(0, 0, 8, 8), texture);
+		Ref<Image> image = render_canvas(canvas, Size2i(8, 8));
+		REQUIRE(image.is_valid());
+		CHECK(pixel_is(image, 0, 0, red));
+		CHECK(pixel_is(image, 7, 0, green));
+		CHECK(pixel_is(image, 0, 7, blue));
+		CHECK(pixel_is(image, 7, 7, white));
+
+		rs->canvas_item_clear(item);
+		rs->canvas_item_add_texture_rect_region(item, Rect2(0, 0, 8, 8), texture, Rect2(1, 0, 1, 1), Color(1, 1, 1, 0.5));
+		image = render_canvas(canvas, Size2i(8, 8));
+		CHECK(pixel_is(image, 4, 4, Color(0, 0.5, 0, 0.5)));
+
+		rs->free(texture);
+	}
+
+	SUBCASE("Batched texture rect regions") {
+		Ref<Image> texture_image = Image::create_empty(2, 1, false, Image::FORMAT_RGBA8);
+		texture_image->set_pixel(0, 0, red);
+		texture_image->set_pixel(1, 0, green);
+		RID texture = rs->texture_2d_create(texture_image);
+
+		// Four 4x4 quads: red, green, half transparent green, and green flipped horizontally.
+		const Vector<float> rects = { 0, 0, 4, 4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4 };
+		const Vector<float> src_rects = { 0, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0, -1, 1 };
+		rs->canvas_item_add_texture_rect_regions(item, texture, rects, src_rects, { white, white, Color(1, 1, 1, 0.5), white });
+		Ref<Image> image = render_canvas(canvas, Size2i(8, 8));
+		REQUIRE(image.is_valid());
+		CHECK(pixel_is(image, 1, 1, red));
+		CHECK(pixel_is(image, 6, 1, green));
+		CHECK(pixel_is(image, 1, 6, Color(0, 0.5, 0, 0.5)));
+		CHECK(pixel_is(image, 6, 6, green));
+
+		rs->canvas_item_clear(item);
+		ERR_PRINT_OFF;
+		rs->canvas_item_add_texture_rect_regions(item, texture, rects, { 0, 0, 1, 1 });
+		ERR_PRINT_ON;
+		image = render_canvas(canvas, Size2i(8, 8));
+		CHECK_MESSAGE(pixel_is(image, 1, 1, transparent), "Mismatched source rects should draw nothing.");
+
+		rs->free(texture);
+	}
+
+	SUBCASE("Nine-patches") {
+		// Red border around a green center.
+		Ref<Image> texture_image = Image::create_empty(3, 3, false, Image::FORMAT_RGBA8);
+		texture_image->fill(red);
+		texture_image->set_pixel(1, 1, green);
+		RID texture = rs->texture_2d_create(texture_image);
+
+		rs->canvas_item_add_nine_patch(item, Rect2(0, 0, 8, 8), Rect2(), texture, Vector2(1, 1), Vector2(1, 1));
+		Ref<Image> image = render_canvas(canvas, Size2i(8, 8));
+		REQUIRE(image.is_valid());
+		CHECK(pixel_is(image, 0, 0, red));
+		CHECK(pixel_is(image, 4, 0, red));
+		CHECK(pixel_is(image, 7, 4, red));
+		CHECK(pixel_is(image, 1, 1, green));
+		CHECK(pixel_is(image, 6, 6, green));
+
+		rs->canvas_item_clear(item);
+		rs->canvas_item_add_nine_patch(item, Rect2(0, 0, 8, 8), Rect2(), texture, Vector2(1, 1), Vector2(1, 1), RS::NINE_PATCH_STRETCH, RS::NINE_PATCH_STRETCH, false);
+		image = render_canvas(canvas, Size2i(8, 8));
+		CHECK(pixel_is(image, 0, 4, red));
+		CHECK(pixel_is(image, 4, 4, transparent));
+
+		rs->free(texture);
+	}
+
+	SUBCASE("Polygons") {
+		Vector<Point2> points = { Point2(0, 0), Point2(8, 0), Point2(0, 8) };
+		rs->canvas_item_add_polygon(item, points, { blue });
+		Ref<Image> image = render_canvas(canvas, Size2i(8, 8));
+		REQUIRE(image.is_valid());
+		CHECK(pixel_is(image, 1, 1, blue));
+		CHECK(pixel_is(image, 6, 0, blue));
+		CHECK(pixel_is(image, 6, 6, transparent));
+	}
+
+	SUBCASE("Shared edges are drawn once") {
+		// The diagonal between the two triangles of the rect goes through pixel centers.
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 8, 8), Color(1, 1, 1, 0.5));
+		Ref<Image> image = render_canvas(canvas, Size2i(8, 8));
+		REQUIRE(image.is_valid());
+		for (int i = 0; i < 8; i++) {
+			CHECK(pixel_is(image, i, i, Color(0.5, 0.5, 0.5, 0.5)));
+		}
+	}
+
+	SUBCASE("Tiles and transforms") {
+		// Larger than a tile, rotated and clipped.
+		rs->canvas_item_set_transform(item, Transform2D(Math_PI / 2.0, Vector2(200, 0)));
+		rs->canvas_item_add_rect(item, Rect2(0, 0, 100, 150), green);
+		Ref<Image> image = render_canvas(canvas, Size2i(160, 120));
+		REQUIRE(image.is_valid());
+		CHECK(pixel_is(image, 55, 5, green));
+		CHECK(pixel_is(image, 120, 90, green));
+		CHECK(pixel_is(image, 159, 99, green));
+		CHECK(pixel_is(image, 45, 5, transparent));
+		CHECK(pixel_is(image, 100, 110, transparent));
+	}
+
+	rs->free(item);
+	rs->free(canvas);
+}
+
+} // namespace TestRasterizerCanvasSoftware
+
+#endif // TEST_RASTERIZER_CANVAS_SOFTWARE_H
@@ -0,0 +1,384 @@
+/**************************************************************************/
+/*  test_renderer_canvas_cull.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RENDERER_CANVAS_CULL_H
+#define TEST_RENDERER_CANVAS_CULL_H
+
+#include "core/os/os.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererCanvasCull {
+
+// Children in a grid, 64 pixels apart.
+static RID create_grid(RID p_canvas, int p_width, int p_height, LocalVector<RID> &r_children) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID parent = rs->canvas_item_create();
+	rs->canvas_item_set_parent(parent, p_canvas);
+	for (int y = 0; y < p_height; y++) {
+		for (int x = 0; x < p_width; x++) {
+			RID child = rs->canvas_item_create();
+			rs->canvas_item_set_parent(child, parent);
+			rs->canvas_item_set_transform(child, Transform2D(0, Vector2(x * 64, y * 64)));
+			rs->canvas_item_add_rect(child, Rect2(0, 0, 32, 32), Color(1, 1, 1));
+			r_children.push_back(child);
+		}
+	}
+	return parent;
+}
+
+// Returns which of the children were attached for drawing.
+static Vector<bool> cull_children(RID p_canvas, const LocalVector<RID> &p_children, const Transform2D &p_transform, bool p_use_cull_index) {
+	RendererCanvasCull *canvas_cull = RSG::canvas;
+	for (const RID &child : p_children) {
+		canvas_cull->canvas_item_owner.get_or_null(child)->z_final = INT_MIN;
+	}
+
+	const bool was_using_cull_index = canvas_cull->is_using_cull_index();
+	canvas_cull->set_use_cull_index(p_use_cull_index);
+	canvas_cull->render_canvas(RID(), canvas_cull->canvas_owner.get_or_null(p_canvas), p_transform, nullptr, nullptr, Rect2(0, 0, 300, 200), RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xFFFFFFFF);
+	canvas_cull->set_use_cull_index(was_using_cull_index);
+
+	Vector<bool> drawn;
+	for (const RID &child : p_children) {
+		drawn.push_back(canvas_cull->canvas_item_owner.get_or_null(child)->z_final != INT_MIN);
+	}
+	return drawn;
+}
+
+static int count_drawn(const Vector<bool> &p_drawn) {
+	int count = 0;
+	for (bool drawn : p_drawn) {
+		count += drawn ? 1 : 0;
+	}
+	return count;
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Spatial index draws the same children") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID canvas = rs->canvas_create();
+	LocalVector<RID> children;
+	RID parent = create_grid(canvas, 32, 32, children);
+
+	SUBCASE("Visible children") {
+		const Transform2D transforms[] = {
+			Transform2D(),
+			Transform2D(0, Vector2(-1000, -700)),
+			Transform2D(Math_PI / 6.0, Vector2(500, -300)),
+			Transform2D(0, Size2(0.25, 0.5), 0, Vector2(-10, 0)),
+		};
+		for (const Transform2D &transform : transforms) {
+			const Vector<bool> drawn = cull_children(canvas, children, transform, false);
+			CHECK(count_drawn(drawn) > 0);
+			CHECK(count_drawn(drawn) < (int)children.size());
+			CHECK(cull_children(canvas, children, transform, true) == drawn);
+		}
+		// Offscreen canvas.
+		CHECK(count_drawn(cull_children(canvas, children, Transform2D(0, Vector2(-10000, 0)), true)) == 0);
+	}
+
+	SUBCASE("Moved children") {
+		cull_children(canvas, children, Transform2D(), true);
+		const RID far_child = children[children.size() - 1];
+		CHECK_FALSE(cull_children(canvas, children, Transform2D(), true)[children.size() - 1]);
+
+		rs->canvas_item_set_transform(far_child, Transform2D(0, Vector2(100, 100)));
+		CHECK(cull_children(canvas, children, Transform2D(), true)[children.size() - 1]);
+
+		rs->canvas_item_clear(far_child);
+		rs->canvas_item_add_rect(far_child, Rect2(-1000, -1000, 32, 32), Color(1, 1, 1));
+		CHECK_FALSE(cull_children(canvas, children, Transform2D(), true)[children.size() - 1]);
+	}
+
+	SUBCASE("Children with children are always visited") {
+		cull_children(canvas, children, Transform2D(), true);
+		const RID far_child = children[children.size() - 1];
+		RID grandchild = rs->canvas_item_create();
+		rs->canvas_item_set_parent(grandchild, far_child);
+		rs->canvas_item_set_transform(grandchild, Transform2D(0, Vector2(-1984, -1984)));
+		rs->canvas_item_add_rect(grandchild, Rect2(0, 0, 32, 32), Color(1, 1, 1));
+
+		LocalVector<RID> grandchildren;
+		grandchildren.push_back(grandchild);
+		CHECK(cull_children(canvas, grandchildren, Transform2D(), true)[0]);
+
+		rs->free(grandchild);
+	}
+
+	SUBCASE("Removed and added children") {
+		cull_children(canvas, children, Transform2D(), true);
+		rs->free(children[0]);
+		children.remove_at(0);
+		RID new_child = rs->canvas_item_create();
+		rs->canvas_item_set_parent(new_child, parent);
+		rs->canvas_item_add_rect(new_child, Rect2(0, 0, 32, 32), Color(1, 1, 1));
+		children.push_back(new_child);
+
+		const Vector<bool> drawn = cull_children(canvas, children, Transform2D(), false);
+		CHECK(drawn[children.size() - 1]);
+		CHECK(cull_children(canvas, children, Transform2D(), true) == drawn);
+	}
+
+	for (const RID &child : children) {
+		rs->free(child);
+	}
+	rs->free(parent);
+	rs->free(canvas);
+}
+
+// Returns the item drawn after each of the items, or the item itself when it wasn't drawn.
+static Vector<RendererCanvasRender::Item *> draw_order(RID p_canvas, const LocalVector<RID> &p_items, int p_thread_cull_threshold) {
+	RendererCanvasCull *canvas_cull = RSG::canvas;
+	for (const RID &item : p_items) {
+		RendererCanvasCull::Item *ci = canvas_cull->canvas_item_owner.get_or_null(item);
+		ci->next = nullptr;
+		ci->z_final = INT_MIN;
+	}
+
+	const int thread_cull_threshold = canvas_cull->get_thread_cull_threshold();
+	canvas_cull->set_thread_cull_threshold(p_thread_cull_threshold);
+	canvas_cull->render_canvas(RID(), canvas_cull->canvas_owner.get_or_null(p_canvas), Transform2D(), nullptr, nullptr, Rect2(0, 0, 300, 200), RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xFFFFFFFF);
+	canvas_cull->set_thread_cull_threshold(thread_cull_threshold);
+
+	Vector<RendererCanvasRender::Item *> order;
+	for (const RID &item : p_items) {
+		RendererCanvasCull::Item *ci = canvas_cull->canvas_item_owner.get_or_null(item);
+		order.push_back(ci->z_final != INT_MIN ? ci->next : ci);
+	}
+	return order;
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Threaded culling keeps the draw order") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID canvas = rs->canvas_create();
+	LocalVector<RID> items;
+
+	RID parent = rs->canvas_item_create();
+	rs->canvas_item_set_parent(parent, canvas);
+	rs->canvas_item_add_rect(parent, Rect2(0, 0, 300, 200), Color(0, 0, 0));
+	items.push_back(parent);
+
+	RID ysort_parent = rs->canvas_item_create();
+	rs->canvas_item_set_parent(ysort_parent, canvas);
+	rs->canvas_item_set_sort_children_by_y(ysort_parent, true);
+	items.push_back(ysort_parent);
+
+	for (int i = 0; i < 2000; i++) {
+		RID child = rs->canvas_item_create();
+		rs->canvas_item_set_parent(child, parent);
+		rs->canvas_item_set_transform(child, Transform2D(0, Vector2((i % 40) * 8, (i / 40) * 5)));
+		rs->canvas_item_add_rect(child, Rect2(0, 0, 16, 16), Color(1, 1, 1));
+		rs->canvas_item_set_z_index(child, i % 3 - 1);
+		rs->canvas_item_set_draw_behind_parent(child, i % 11 == 0);
+		items.push_back(child);
+
+		RID ysort_child = rs->canvas_item_create();
+		rs->canvas_item_set_parent(ysort_child, ysort_parent);
+		rs->canvas_item_set_transform(ysort_child, Transform2D(0, Vector2((i % 40) * 8, (i * 7919) % 250)));
+		rs->canvas_item_add_rect(ysort_child, Rect2(0, 0, 16, 16), Color(1, 1, 1));
+		items.push_back(ysort_child);
+
+		if (i % 100 == 0) {
+			// A canvas group, and a y-sorted item with children.
+			RID group_child = rs->canvas_item_create();
+			rs->canvas_item_set_parent(group_child, child);
+			rs->canvas_item_add_rect(group_child, Rect2(0, 0, 8, 8), Color(1, 0, 0));
+			rs->canvas_item_set_canvas_group_mode(child, RS::CANVAS_GROUP_MODE_CLIP_AND_DRAW);
+			items.push_back(group_child);
+
+			RID ysort_grandchild = rs->canvas_item_create();
+			rs->canvas_item_set_parent(ysort_grandchild, ysort_child);
+			rs->canvas_item_set_transform(ysort_grandchild, Transform2D(0, Vector2(4, 30)));
+			rs->canvas_item_add_rect(ysort_grandchild, Rect2(0, 0, 8, 8), Color(0, 1, 0));
+			items.push_back(ysort_grandchild);
+		}
+	}
+
+	const Vector<RendererCanvasRender::Item *> order = draw_order(canvas, items, 65536);
+	CHECK(draw_order(canvas, items, 32) == order);
+	CHECK(draw_order(canvas, items, 1024) == order);
+
+	// Again, after moving some of the items.
+	for (uint32_t i = 2; i < items.size(); i += 5) {
+		rs->canvas_item_set_transform(items[i], Transform2D(0, Vector2((i * 31) % 300, (i * 17) % 200)));
+	}
+	const Vector<RendererCanvasRender::Item *> moved_order = draw_order(canvas, items, 65536);
+	CHECK(moved_order != order);
+	CHECK(draw_order(canvas, items, 32) == moved_order);
+
+	for (int i = items.size() - 1; i >= 0; i--) {
+		rs->free(items[i]);
+	}
+	rs->free(canvas);
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Y-sort order is kept up to date") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID canvas = rs->canvas_create();
+	LocalVector<RID> items;
+
+	RID ysort_parent = rs->canvas_item_create();
+	rs->canvas_item_set_parent(ysort_parent, canvas);
+	rs->canvas_item_set_sort_children_by_y(ysort_parent, true);
+	items.push_back(ysort_parent);
+
+	for (int i = 0; i < 500; i++) {
+		RID child = rs->canvas_item_create();
+		rs->canvas_item_set_parent(child, ysort_parent);
+		rs->canvas_item_set_transform(child, Transform2D(0, Vector2(i % 20, (i * 7919) % 150)));
+		rs->canvas_item_add_rect(child, Rect2(0, 0, 16, 16), Color(1, 1, 1));
+		items.push_back(child);
+
+		if (i % 50 == 0) {
+			RID ysort_grandchild = rs->canvas_item_create();
+			rs->canvas_item_set_parent(ysort_grandchild, child);
+			rs->canvas_item_set_transform(ysort_grandchild, Transform2D(0, Vector2(0, 20)));
+			rs->canvas_item_add_rect(ysort_grandchild, Rect2(0, 0, 8, 8), Color(1, 1, 1));
+			rs->canvas_item_set_sort_children_by_y(child, true);
+			items.push_back(ysort_grandchild);
+		}
+	}
+	draw_order(canvas, items, INT_MAX);
+
+	// Sorting the items again from scratch gives the same order.
+	const auto check_against_full_sort = [&]() {
+		const Vector<RendererCanvasRender::Item *> order = draw_order(canvas, items, INT_MAX);
+		rs->canvas_item_set_sort_children_by_y(ysort_parent, true);
+		CHECK(draw_order(canvas, items, INT_MAX) == order);
+	};
+
+	SUBCASE("A few moved items") {
+		for (uint32_t i = 1; i < items.size(); i += 37) {
+			rs->canvas_item_set_transform(items[i], Transform2D(0, Vector2(0, (i * 13) % 150)));
+		}
+		check_against_full_sort();
+	}
+
+	SUBCASE("All moved items") {
+		for (uint32_t i = 1; i < items.size(); i++) {
+			rs->canvas_item_set_transform(items[i], Transform2D(0, Vector2(0, 150 - (i * 7) % 150)));
+		}
+		check_against_full_sort();
+	}
+
+	SUBCASE("Added and hidden items") {
+		RID child = rs->canvas_item_create();
+		rs->canvas_item_set_parent(child, ysort_parent);
+		rs->canvas_item_set_transform(child, Transform2D(0, Vector2(0, 75)));
+		rs->canvas_item_add_rect(child, Rect2(0, 0, 16, 16), Color(1, 1, 1));
+		items.push_back(child);
+		rs->canvas_item_set_visible(items[10], false);
+
+		const Vector<RendererCanvasRender::Item *> order = draw_order(canvas, items, INT_MAX);
+		CHECK(order[items.size() - 1] != RSG::canvas->canvas_item_owner.get_or_null(child));
+		CHECK(order[10] == RSG::canvas->canvas_item_owner.get_or_null(items[10]));
+		check_against_full_sort();
+	}
+
+	for (int i = items.size() - 1; i >= 0; i--) {
+		rs->free(items[i]);
+	}
+	rs->free(canvas);
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Rebuilt items and retained polygons") {
+	Vector<Point2> points = { Point2(0, 0), Point2(10, 0), Point2(10, 10) };
+	const Vector<Color> colors = { Color(1, 1, 1) };
+	const uint64_t hash = RendererCanvasRender::Item::hash_polygon(Vector<int>(), points, colors, Vector<Point2>(), Vector<int>(), Vector<float>());
+	CHECK(RendererCanvasRender::Item::hash_polygon(Vector<int>(), points, colors, Vector<Point2>(), Vector<int>(), Vector<float>()) == hash);
+	// The same data in another array is a different polygon.
+	CHECK(RendererCanvasRender::Item::hash_polygon(Vector<int>(), Vector<Point2>(), colors, points, Vector<int>(), Vector<float>()) != hash);
+
+	// Polygons with the same hash are only reused when their data is the same.
+	RendererCanvasRender::PolygonData data;
+	data.points = points;
+	data.colors = colors;
+	CHECK(data.matches(Vector<int>(), points, colors, Vector<Point2>(), Vector<int>(), Vector<float>()));
+	const Vector<Point2> points_copy = { Point2(0, 0), Point2(10, 0), Point2(10, 10) };
+	CHECK(data.matches(Vector<int>(), points_copy, colors, Vector<Point2>(), Vector<int>(), Vector<float>()));
+	CHECK_FALSE(data.matches(Vector<int>(), Vector<Point2>(), colors, points, Vector<int>(), Vector<float>()));
+
+	points.write[2] = Point2(10, 11);
+	CHECK(RendererCanvasRender::Item::hash_polygon(Vector<int>(), points, colors, Vector<Point2>(), Vector<int>(), Vector<float>()) != hash);
+	CHECK_FALSE(data.matches(Vector<int>(), points, colors, Vector<Point2>(), Vector<int>(), Vector<float>()));
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID canvas = rs->canvas_create();
+	RID item = rs->canvas_item_create();
+	rs->canvas_item_set_parent(item, canvas);
+	RSG::canvas->update();
+	CHECK(rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_CANVAS_ITEMS_REBUILT_IN_FRAME) == 0);
+
+	for (int i = 0; i < 3; i++) {
+		rs->canvas_item_clear(item);
+		rs->canvas_item_add_polygon(item, points, colors);
+	}
+	RSG::canvas->update();
+	CHECK(rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_CANVAS_ITEMS_REBUILT_IN_FRAME) == 3);
+	RSG::canvas->update();
+	CHECK(rs->get_rendering_info(RS::RENDERING_INFO_TOTAL_CANVAS_ITEMS_REBUILT_IN_FRAME) == 0);
+
+	rs->free(item);
+	rs->free(canvas);
+}
+
+TEST_CASE_PENDING("[SceneTree][RendererCanvasCull] Culling benchmark") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID canvas = rs->canvas_create();
+	LocalVector<RID> children;
+	RID parent = create_grid(canvas, 500, 400, children);
+
+	constexpr int FRAMES = 100;
+	RendererCanvasCull *canvas_cull = RSG::canvas;
+	const int thread_cull_threshold = canvas_cull->get_thread_cull_threshold();
+	for (bool threaded : { false, true }) {
+		canvas_cull->set_thread_cull_threshold(threaded ? thread_cull_threshold : INT_MAX);
+		for (bool use_cull_index : { false, true }) {
+			const uint64_t start = OS::get_singleton()->get_ticks_usec();
+			for (int i = 0; i < FRAMES; i++) {
+				cull_children(canvas, LocalVector<RID>(), Transform2D(0, Vector2(-i * 64, -i * 32)), use_cull_index);
+			}
+			MESSAGE("Culled ", children.size(), " children ", FRAMES, " times ", use_cull_index ? "with" : "without", " spatial index", threaded ? " on multiple threads: " : ": ", OS::get_singleton()->get_ticks_usec() - start, " usec.");
+		}
+	}
+	canvas_cull->set_thread_cull_threshold(thread_cull_threshold);
+
+	for (const RID &child : children) {
+		rs->free(child);
+	}
+	rs->free(parent);
+	rs->free(canvas);
+}
+
+} // namespace TestRendererCanvasCull
+
+#endif // TEST_RENDERER_CANVAS_CULL_H
@@ -84,7 +84,9 @@
 #include "tests/core/object/test_class_db.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
+#include "tests/core/object/test_property_accessor.h"
 #include "tests/core/object/test_undo_redo.h"
+#include "tests/core/os/test_memory.h"
 #include "tests/core/os/test_os.h"
 #include "tests/core/string/test_fuzzy_search.h"
 #include "tests/core/string/test_node_path.h"
@@ -93,14 +95,18 @@
 #include "tests/core/string/test_translation_server.h"
 #include "tests/core/templates/test_a_hash_map.h"
 #include "tests/core/templates/test_command_queue.h"
+#include "tests/core/templates/test_dense_hash_map.h"
+#include "tests/core/templates/test_frame_allocator.h"
 #include "tests/core/templates/test_hash_map.h"
 #include "tests/core/templates/test_hash_set.h"
+#include "tests/core/templates/test_inline_vector.h"
 #include "tests/core/templates/test_list.h"
 #include "tests/core/templates/test_local_vector.h"
 #include "tests/core/templates/test_lru.h"
 #include "tests/core/templates/test_oa_hash_map.h"
 #include "tests/core/templates/test_paged_array.h"
 #include "tests/core/templates/test_rid.h"
+#include "tests/core/templates/test_swiss_hash_map.h"
 #include "tests/core/templates/test_vector.h"
 #include "tests/core/test_crypto.h"
 #include "tests/core/test_hashing_context.h"
@@ -137,10 +143,13 @@
 #include "tests/scene/test_style_box_texture.h"
 #include "tests/scene/test_texture_progress_bar.h"
 #include "tests/scene/test_theme.h"
+#include "tests/scene/test_tile_map_layer.h"
 #include "tests/scene/test_timer.h"
 #include "tests/scene/test_viewport.h"
 #include "tests/scene/test_visual_shader.h"
 #include "tests/scene/test_window.h"
+#include "tests/servers/rendering/test_rasterizer_canvas_software.h"
+#include "tests/servers/rendering/test_renderer_canvas_cull.h"
 #include "tests/servers/rendering/test_shader_preprocessor.h"
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
@@ -299,6 +308,8 @@ struct GodotTestCaseListener : public doctest::IReporter {
 					break;
 				}
 			}
+			// Tests tagged [SoftwareCanvas] draw 2D on the CPU, to read back what was rendered.
+			ProjectSettings::get_singleton()->set_setting("rendering/2d/software_canvas/enabled", name.contains("[SoftwareCanvas]"));
 			memnew(RenderingServerDefault());
 			RenderingServerDefault::get_singleton()->init();
 			RenderingServerDefault::get_singleton()->set_render_loop_enabled(false);